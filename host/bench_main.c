@@ -0,0 +1,195 @@
+/**
+ * @file bench_main.c
+ * @brief Banco de pruebas de host para la lógica de los minijuegos.
+ *
+ * Ejecuta cada minijuego durante N frames simulados con una entrada de mando
+ * pseudoaleatoria reproducible, mide el tiempo de update/render y muestra
+ * cuántas llamadas a la API de SGDK hace cada frame. Si el minijuego termina
+ * antes, se reinicia para completar los frames pedidos.
+ *
+ * Con --stress, antes de cada update se llama al forceStress del minijuego,
+ * que rellena todos los huecos libres (elfos, enemigos, regalos, balas...):
+ * mide la fase siempre en su peor caso en lugar de en el ritmo normal.
+ *
+ * Con --csv no se imprime el resumen: sale una fila por frame (escenario,
+ * frame, ns de update, ns de render, sprites activos) para localizar el
+ * frame exacto de una regresión.
+ *
+ * Uso: ./sleigh_bench [--stress] [--csv] [frames] [pickup|delivery|bells|celebration]
+ */
+#include <genesis.h>
+#include <time.h>
+
+#include "host_stub.h"
+#include "game_core.h"
+#include "minigame_pickup.h"
+#include "minigame_delivery.h"
+#include "minigame_bells.h"
+#include "minigame_celebration.h"
+
+#define BENCH_DEFAULT_FRAMES 10000  /**< Frames simulados por minijuego. */
+#define BENCH_INPUT_HOLD 12         /**< Frames que se mantiene cada pulsación. */
+#define BENCH_TOP_CALLS 8           /**< Funciones SGDK listadas por minijuego. */
+
+/** @brief Descripción de un minijuego ejecutable en el banco. */
+typedef struct {
+    const char *name;
+    void (*init)(void);
+    void (*update)(void);
+    void (*render)(void);
+    u8 (*isComplete)(void);
+    void (*shutdown)(void);
+    void (*stress)(void);   /**< Fuerza el peor caso (NULL si no aplica). */
+} BenchScenario;
+
+static const BenchScenario scenarios[] = {
+    { "pickup", minigamePickup_init, minigamePickup_update, minigamePickup_render,
+      minigamePickup_isComplete, minigamePickup_shutdown, minigamePickup_forceStress },
+    { "delivery", minigameDelivery_init, minigameDelivery_update, minigameDelivery_render,
+      minigameDelivery_isComplete, minigameDelivery_shutdown, minigameDelivery_forceStress },
+    { "bells", minigameBells_init, minigameBells_update, minigameBells_render,
+      minigameBells_isComplete, minigameBells_shutdown, minigameBells_forceStress },
+    { "celebration", minigameCelebration_init, minigameCelebration_update, minigameCelebration_render,
+      minigameCelebration_isComplete, minigameCelebration_shutdown, NULL },
+};
+
+/** @brief Convierte un número decimal (stdlib choca con random() de SGDK). */
+static u32 parseFrames(const char *text) {
+    u32 value = 0;
+    while (*text >= '0' && *text <= '9') {
+        value = (value * 10) + (u32)(*text++ - '0');
+    }
+    return value;
+}
+
+/** @brief Tiempo monotónico en nanosegundos. */
+static u64 nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+/** @brief Entrada de mando guionizada: dirección + A aleatorios mantenidos unos frames. */
+static u16 scriptedInput(u32 frame, u32 *lcg) {
+    static u16 held = 0;
+    if ((frame % BENCH_INPUT_HOLD) == 0) {
+        static const u16 dirs[] = { 0, BUTTON_LEFT, BUTTON_RIGHT, BUTTON_UP, BUTTON_DOWN,
+            BUTTON_LEFT | BUTTON_UP, BUTTON_RIGHT | BUTTON_DOWN };
+        *lcg = (*lcg * 1103515245u) + 12345u;
+        held = dirs[(*lcg >> 16) % (sizeof(dirs) / sizeof(dirs[0]))];
+        if ((*lcg >> 8) & 1) held |= BUTTON_A;
+    }
+    return held;
+}
+
+/** @brief Lista las funciones SGDK más llamadas por frame. */
+static void printTopCalls(u32 frames) {
+    const HostCallSite *top[BENCH_TOP_CALLS] = { NULL };
+    for (const HostCallSite *site = hostStub_getCallSites(); site != NULL; site = site->next) {
+        if (site->count == 0) continue;
+        for (u16 i = 0; i < BENCH_TOP_CALLS; i++) {
+            if (top[i] == NULL || site->count > top[i]->count) {
+                memmove(&top[i + 1], &top[i], (BENCH_TOP_CALLS - i - 1) * sizeof(top[0]));
+                top[i] = site;
+                break;
+            }
+        }
+    }
+    for (u16 i = 0; i < BENCH_TOP_CALLS && top[i] != NULL; i++) {
+        printf("    %-28s %8.2f/frame\n", top[i]->name, (double)top[i]->count / frames);
+    }
+}
+
+/** @brief Ejecuta un escenario y muestra sus métricas (o una fila CSV por frame). */
+static void runScenario(const BenchScenario *scenario, u32 frames, u8 stress, u8 csv) {
+    static const char *groups[] = { "SPR_", "MAP_", "VDP_", "PAL_", "DMA_", "XGM2_" };
+    u32 lcg = 0xC0FFEE;
+    u32 restarts = 0;
+    u64 updateNs = 0;
+    u64 renderNs = 0;
+    u64 worstNs = 0;
+    u64 worstUpdateNs = 0;
+    u32 spriteSum = 0;
+    u16 spritePeak = 0;
+
+    hostStub_reset();
+    gameCore_seedRandom(0x5EED);
+    scenario->init();
+    gameCore_resetSpriteCacheStats();
+
+    for (u32 frame = 0; frame < frames; frame++) {
+        hostStub_setJoypad(scriptedInput(frame, &lcg));
+
+        if (stress) scenario->stress();
+        const u64 t0 = nowNs();
+        scenario->update();
+        const u64 t1 = nowNs();
+        scenario->render();
+        const u64 t2 = nowNs();
+        gameCore_waitVBlank();
+
+        updateNs += t1 - t0;
+        renderNs += t2 - t1;
+        if ((t2 - t0) > worstNs) worstNs = t2 - t0;
+        if ((t1 - t0) > worstUpdateNs) worstUpdateNs = t1 - t0;
+        const u16 sprites = SPR_getNumActiveSprite();
+        spriteSum += sprites;
+        if (sprites > spritePeak) spritePeak = sprites;
+        if (csv) {
+            printf("%s%s,%u,%llu,%llu,%u\n", scenario->name, stress ? "-estres" : "", frame,
+                (unsigned long long)(t1 - t0), (unsigned long long)(t2 - t1), sprites);
+        }
+
+        if (scenario->isComplete()) {
+            scenario->shutdown();
+            scenario->init();
+            restarts++;
+        }
+    }
+    scenario->shutdown();
+    if (csv) return;
+
+    printf("%s%s: %u frames, %u reinicios\n", scenario->name, stress ? " (estres)" : "", frames, restarts);
+    printf("  update %.0f ns/frame (peor %llu), render %.0f ns/frame, peor frame %llu ns\n",
+        (double)updateNs / frames, (unsigned long long)worstUpdateNs,
+        (double)renderNs / frames, (unsigned long long)worstNs);
+    printf("  sprites: %.2f activos/frame, pico %u\n", (double)spriteSum / frames, spritePeak);
+    printf("  llamadas/frame:");
+    for (u16 i = 0; i < sizeof(groups) / sizeof(groups[0]); i++) {
+        printf(" %s%.2f", groups[i], (double)hostStub_getCallsByPrefix(groups[i]) / frames);
+    }
+    printf("\n");
+    const GameSpriteCacheStats *cache = gameCore_getSpriteCacheStats();
+    printf("  cache SPR_*: %.2f reenviadas/frame, %.2f evitadas/frame\n",
+        (double)cache->forwarded / frames, (double)cache->skipped / frames);
+    printf("  vram: pico %u tiles de usuario\n", gameCore_vramGetHighWater());
+    printTopCalls(frames);
+}
+
+int main(int argc, char **argv) {
+    u32 frames = BENCH_DEFAULT_FRAMES;
+    const char *only = NULL;
+    u8 stress = FALSE;
+    u8 csv = FALSE;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--stress") == 0) stress = TRUE;
+        else if (strcmp(argv[i], "--csv") == 0) csv = TRUE;
+        else if (argv[i][0] >= '0' && argv[i][0] <= '9') frames = parseFrames(argv[i]);
+        else only = argv[i];
+    }
+
+    if (frames == 0) {
+        fprintf(stderr, "uso: %s [--stress] [--csv] [frames] [pickup|delivery|bells|celebration]\n", argv[0]);
+        return 1;
+    }
+
+    if (csv) printf("escenario,frame,update_ns,render_ns,sprites\n");
+
+    for (u16 i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (only != NULL && strcmp(only, scenarios[i].name) != 0) continue;
+        if (stress && scenarios[i].stress == NULL) continue;
+        runScenario(&scenarios[i], frames, stress, csv);
+    }
+    return 0;
+}
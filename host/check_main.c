@@ -0,0 +1,137 @@
+/**
+ * @file check_main.c
+ * @brief Comprobaciones de host de los servicios de game_core que dependen del haz
+ * (marcas de línea y gobernador de calidad) y del planificador de tareas.
+ *
+ * El stub de SGDK simula el contador V ajustado y la VInt (vtimer sube en la
+ * línea 224 y el contador vuelve a 0 al final del VBlank), así que aquí se
+ * puede colocar una medida en cualquier punto del frame, cosa que el banco
+ * de pruebas nunca hace.
+ *
+ * Uso: ./sleigh_check (sale con 1 si falla alguna comprobación)
+ */
+#include <genesis.h>
+
+#include "host_stub.h"
+#include "game_core.h"
+
+static u16 failures = 0;
+
+/** @brief Anota una comprobación fallida con su línea. */
+#define CHECK(cond) do { if (!(cond)) { printf("  FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/** @brief Mide con dos marcas de línea separadas por un avance del haz. */
+static u32 measureLines(u16 lines) {
+    const u32 start = gameCore_getLineStamp();
+    hostStub_advanceBeam(lines);
+    return gameCore_getLineStamp() - start;
+}
+
+/** @brief Una medida que empieza dentro del VBlank (como el update tras SYS_doVBlankProcess). */
+static void checkStampFromVBlank(void) {
+    hostStub_reset();
+    SYS_doVBlankProcess();
+    /* Cruza el final del VBlank hacia la pantalla activa. */
+    const u32 cost = measureLines(60);
+    CHECK(cost >= 60 && cost <= 62);
+}
+
+/** @brief Una medida en pantalla activa que cruza la VInt. */
+static void checkStampAcrossVInt(void) {
+    hostStub_reset();
+    hostStub_advanceBeam(200);
+    const u32 frame = vtimer;
+    const u32 cost = measureLines(40);
+    CHECK(vtimer == frame + 1);
+    CHECK(cost >= 40 && cost <= 43);
+}
+
+/** @brief La marca tomada justo en la línea de la VInt no se adelanta un frame. */
+static void checkStampAtVIntLine(void) {
+    hostStub_reset();
+    /* La marca final cae en la línea de la VInt: vtimer cambia durante la lectura. */
+    hostStub_advanceBeam(GAME_VINT_LINE - 3);
+    const u32 cost = measureLines(1);
+    CHECK(vtimer == 1);
+    CHECK(cost >= 1 && cost <= 4);
+}
+
+/** @brief Un frame perdido entero suma sus líneas en lugar de saturar. */
+static void checkStampOverrun(void) {
+    hostStub_reset();
+    SYS_doVBlankProcess();
+    const u32 cost = measureLines(GAME_FRAME_LINES + 30);
+    CHECK(cost >= (u32)GAME_FRAME_LINES + 30 && cost <= (u32)GAME_FRAME_LINES + 32);
+}
+
+/** @brief El gobernador ignora lecturas imposibles y recorta/restaura con las reales. */
+static void checkQualityFeed(void) {
+    gameCore_qualityReset();
+    gameCore_qualityRegister("a", 2);
+    gameCore_qualityRegister("b", 0);
+
+    for (u16 i = 0; i < 10; i++) gameCore_qualityFeed(0xFFFF, FALSE);
+    CHECK(gameCore_qualityGetShedCount() == 0);
+
+    gameCore_qualityFeed(GAME_QUALITY_SHED_LINES + 1, FALSE);
+    gameCore_qualityFeed(GAME_QUALITY_SHED_LINES + 1, FALSE);
+    CHECK(gameCore_qualityGetShedCount() == 1);
+    gameCore_qualityFeed(0xFFFF, TRUE);
+    CHECK(gameCore_qualityGetShedCount() == 2);
+
+    for (u16 i = 0; i < GAME_QUALITY_RESTORE_FRAMES; i++) gameCore_qualityFeed(40, FALSE);
+    CHECK(gameCore_qualityGetShedCount() == 1);
+    gameCore_qualityReset();
+}
+
+static u8 taskSteps = 0;
+
+/** @brief Tarea de relleno que no termina nunca. */
+static u8 taskForever(GameTask *task) {
+    GAME_TASK_BEGIN(task);
+    while (TRUE) GAME_TASK_YIELD(task);
+    GAME_TASK_END(task);
+}
+
+/** @brief Tarea de tres pasos. */
+static u8 taskThreeSteps(GameTask *task) {
+    GAME_TASK_BEGIN(task);
+    taskSteps++;
+    GAME_TASK_YIELD(task);
+    taskSteps++;
+    GAME_TASK_YIELD(task);
+    taskSteps++;
+    GAME_TASK_END(task);
+}
+
+/** @brief gameCore_taskRun completa la tarea aunque el planificador esté lleno. */
+static void checkTaskRunWhenFull(void) {
+    static GameTask fillers[GAME_TASK_MAX];
+    GameTask task;
+
+    hostStub_reset();
+    for (u8 i = 0; i < GAME_TASK_MAX; i++) gameCore_taskStart(&fillers[i], taskForever, NULL);
+    taskSteps = 0;
+    gameCore_taskRun(&task, taskThreeSteps, NULL);
+    CHECK(taskSteps == 3);
+    CHECK(!gameCore_taskIsRunning(&task));
+
+    for (u8 i = 0; i < GAME_TASK_MAX; i++) gameCore_taskStop(&fillers[i]);
+    gameCore_taskStep();
+}
+
+int main(void) {
+    checkStampFromVBlank();
+    checkStampAcrossVInt();
+    checkStampAtVIntLine();
+    checkStampOverrun();
+    checkQualityFeed();
+    checkTaskRunWhenFull();
+
+    if (failures != 0) {
+        printf("sleigh_check: %u fallos\n", failures);
+        return 1;
+    }
+    printf("sleigh_check: ok\n");
+    return 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file host_stub.h
+ * @brief Control de la capa SGDK simulada de la build de host.
+ *
+ * El banco de pruebas usa estas funciones para inyectar el estado del mando,
+ * reiniciar el estado de la capa simulada entre escenarios y leer cuántas
+ * llamadas a la API de SGDK ha hecho la lógica del juego.
+ */
+#ifndef _HOST_STUB_H_
+#define _HOST_STUB_H_
+
+#include <genesis.h>
+
+/** @brief Contador de llamadas de una función SGDK simulada. */
+typedef struct HostCallSite {
+    const char *name;           /**< Nombre de la función SGDK. */
+    u32 count;                  /**< Llamadas desde el último reinicio. */
+    u8 linked;                  /**< TRUE si ya está en la lista global. */
+    struct HostCallSite *next;  /**< Siguiente contador registrado. */
+} HostCallSite;
+
+/** @brief Reinicia sprites, temporizadores, fundidos y contadores de llamadas. */
+void hostStub_reset(void);
+
+/** @brief Fija el estado que devolverá JOY_readJoypad y dispara el callback de eventos. */
+void hostStub_setJoypad(u16 state);
+
+/**
+ * @brief Avanza el haz simulado; al llegar a la línea de la VInt sube vtimer.
+ *
+ * Cada VDP_getAdjustedVCounter avanza una línea y SYS_doVBlankProcess vuelve
+ * unas líneas dentro del VBlank, así que las pruebas pueden colocar una
+ * medida en cualquier punto del frame.
+ */
+void hostStub_advanceBeam(u16 lines);
+
+/** @brief Número de VBlanks simulados desde el último reinicio. */
+u32 hostStub_getFrames(void);
+
+/** @brief Primer contador de llamadas registrado (lista enlazada). */
+const HostCallSite* hostStub_getCallSites(void);
+
+/** @brief Suma de llamadas de las funciones cuyo nombre empieza por prefix. */
+u32 hostStub_getCallsByPrefix(const char *prefix);
+
+/** @brief Registra una llamada (uso interno de los stubs). */
+void hostStub_count(HostCallSite *site);
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file res_stub.c
+ * @brief Recursos ficticios para la build de host.
+ *
+ * rescomp no se ejecuta en el host, así que cada símbolo declarado en los .h de res/
+ * se define aquí con datos mínimos: paletas negras, tilesets vacíos y una
+ * definición de sprite genérica con varias animaciones en bucle, suficiente
+ * para que SPR_setAnim/SPR_isAnimationDone se comporten como en consola.
+ */
+#include <genesis.h>
+
+#include "res_geesebumps.h"
+#include "resources_bg.h"
+#include "resources_music.h"
+#include "resources_sfx.h"
+#include "resources_sprites.h"
+
+#define STUB_ANIMS 4   /**< Animaciones por definición de sprite. */
+#define STUB_FRAMES 4  /**< Frames por animación. */
+#define STUB_TIMER 4   /**< Duración de cada frame en VBlanks. */
+
+static u16 stubColors[16];
+static u32 stubTiles[8];
+static u16 stubTilemap[1];
+static Palette stubPalette = { 16, stubColors };
+static TileSet stubTileSet = { 0, 1, stubTiles };
+static TileMap stubTileMap = { 0, 1, 1, stubTilemap };
+
+static AnimationFrame stubFrame = { 1, STUB_TIMER, &stubTileSet, NULL };
+static AnimationFrame *stubFrames[STUB_FRAMES] = { &stubFrame, &stubFrame, &stubFrame, &stubFrame };
+static Animation stubAnimation = { STUB_FRAMES, 0, stubFrames };
+static Animation *stubAnimations[STUB_ANIMS] = { &stubAnimation, &stubAnimation, &stubAnimation, &stubAnimation };
+
+#define STUB_PALETTE(name) const Palette name = { 16, stubColors }
+#define STUB_TILESET(name) const TileSet name = { 0, 1, stubTiles }
+#define STUB_MAP(name) const MapDefinition name = { 64, 64, 64, 0, 0, 0, NULL, NULL, NULL, NULL }
+#define STUB_IMAGE(name) const Image name = { &stubPalette, &stubTileSet, &stubTileMap }
+#define STUB_SPRITE(name) const SpriteDefinition name = { 32, 32, &stubPalette, STUB_ANIMS, stubAnimations, 16, 4 }
+#define STUB_BLOB(name, size) const u8 name[size]
+
+/* res_geesebumps.h */
+STUB_PALETTE(geesebumps_pal_black);
+STUB_PALETTE(geesebumps_pal_white);
+STUB_PALETTE(geesebumps_pal_white2);
+STUB_PALETTE(geesebumps_pal_lines);
+STUB_IMAGE(geesebumps_logo_bg);
+STUB_SPRITE(geesebumps_logo_text);
+STUB_SPRITE(geesebumps_logo_line1);
+STUB_SPRITE(geesebumps_logo_line2);
+STUB_BLOB(music_geesebumps, 1024);
+
+/* resources_bg.h */
+STUB_TILESET(image_titulo_tile);
+STUB_MAP(image_titulo_map);
+STUB_PALETTE(image_titulo_pal);
+STUB_TILESET(image_sleigh_chase_tile);
+STUB_MAP(image_sleigh_chase_map);
+STUB_PALETTE(image_sleigh_chase_pal);
+STUB_TILESET(image_primer_plano_nieve_tile);
+STUB_MAP(image_primer_plano_nieve_map);
+STUB_IMAGE(image_fondo_cutscene);
+STUB_TILESET(image_pista_polo_tile);
+STUB_MAP(image_pista_polo_map);
+STUB_PALETTE(image_pista_polo_pal);
+STUB_TILESET(image_fondo_tejados_tile);
+STUB_MAP(image_fondo_tejados_map);
+STUB_PALETTE(image_fondo_tejados_pal);
+STUB_TILESET(image_fondo_tile);
+STUB_MAP(image_fondo_map);
+STUB_PALETTE(image_fondo_pal);
+STUB_TILESET(image_fondo_fiesta_tile);
+STUB_MAP(image_fondo_fiesta_map);
+STUB_PALETTE(image_fondo_fiesta_pal);
+
+/* resources_music.h */
+STUB_BLOB(musica_MerryGentelmen, 2304);
+STUB_BLOB(musica_Rudolph, 5888);
+STUB_BLOB(musica_SleighRide, 42240);
+STUB_BLOB(musica_Fanfarria, 268032);
+
+/* resources_sfx.h */
+STUB_BLOB(snd_campana, 25344);
+STUB_BLOB(snd_bomba, 10496);
+STUB_BLOB(snd_canon, 4864);
+STUB_BLOB(snd_regalo_recogido, 13312);
+STUB_BLOB(snd_obstaculo_golpe, 13312);
+STUB_BLOB(snd_elfo_robando, 16128);
+STUB_BLOB(snd_regalo_disparado1, 16128);
+STUB_BLOB(snd_regalo_disparado2, 11776);
+STUB_BLOB(snd_regalo_disparado3, 13312);
+STUB_BLOB(snd_elfo_choque, 16128);
+STUB_BLOB(snd_santa_hohoho, 16128);
+STUB_BLOB(snd_regalo_desaparece, 10752);
+STUB_BLOB(snd_elfo_volador_robando_1, 13312);
+STUB_BLOB(snd_elfo_volador_robando_2, 13312);
+STUB_BLOB(snd_regalo_quemado, 13312);
+STUB_BLOB(snd_sleigh_chase, 55552);
+STUB_BLOB(snd_letra_ok, 2048);
+STUB_BLOB(snd_letra_no, 2560);
+STUB_BLOB(snd_aplausos, 104960);
+
+/* resources_sprites.h */
+STUB_IMAGE(font);
+STUB_IMAGE(font_dark);
+STUB_SPRITE(sprite_regalo);
+STUB_SPRITE(sprite_santa_car);
+STUB_SPRITE(sprite_arbol_pista);
+STUB_SPRITE(sprite_elfo_lateral);
+STUB_SPRITE(sprite_duende_malo);
+STUB_SPRITE(sprite_marca_x);
+STUB_SPRITE(sprite_sombra_regalo);
+STUB_SPRITE(sprite_icono_regalo);
+STUB_SPRITE(sprite_chimenea);
+STUB_SPRITE(sprite_santa_car_volando);
+STUB_SPRITE(sprite_duende_malo_volador);
+STUB_SPRITE(sprite_marca_x_2);
+STUB_SPRITE(sprite_campana);
+STUB_SPRITE(sprite_campana_bn);
+STUB_SPRITE(sprite_canon);
+STUB_SPRITE(sprite_bomba);
+STUB_SPRITE(sprite_bola_confeti);
+STUB_SPRITE(sprite_letra_f);
+STUB_SPRITE(sprite_letra_bn_f);
+STUB_SPRITE(sprite_letra_e);
+STUB_SPRITE(sprite_letra_bn_e);
+STUB_SPRITE(sprite_letra_l);
+STUB_SPRITE(sprite_letra_bn_l);
+STUB_SPRITE(sprite_letra_i);
+STUB_SPRITE(sprite_letra_bn_i);
+STUB_SPRITE(sprite_letra_z);
+STUB_SPRITE(sprite_letra_bn_z);
+STUB_SPRITE(sprite_letra_2);
+STUB_SPRITE(sprite_letra_bn_2);
+STUB_SPRITE(sprite_letra_0);
+STUB_SPRITE(sprite_letra_bn_0);
+STUB_SPRITE(sprite_letra_6);
+STUB_SPRITE(sprite_letra_bn_6);
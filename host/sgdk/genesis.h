@@ -0,0 +1,343 @@
+/**
+ * @file genesis.h
+ * @brief Cabecera SGDK mínima para compilar la lógica del juego en el host.
+ *
+ * Reproduce solo los tipos, constantes y prototipos que usa el proyecto con
+ * las mismas firmas que SGDK (ver documentos/sgdk-reference-2025-11-15.txt).
+ * Las implementaciones de host/sgdk_stub.c no tocan hardware: registran
+ * cada llamada a SPR_*, MAP_*, VDP_*, PAL_* y XGM2_* para poder contarlas.
+ */
+#ifndef _HOST_GENESIS_H_
+#define _HOST_GENESIS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* TIPOS (mismo ancho que en m68k) */
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef u8 bool;
+typedef volatile s16 vs16;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+typedef s16 fix16;
+typedef s32 fix32;
+typedef void VoidCallback(void);
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+#ifndef TRUE
+#define TRUE 1
+#endif
+#define false FALSE
+#define true TRUE
+
+/* MATEMÁTICAS FIX16 (10.6) */
+#define FIX16_INT_BITS 10
+#define FIX16_FRAC_BITS (16 - FIX16_INT_BITS)
+#define FIX16(value) ((fix16) ((value) * (1 << FIX16_FRAC_BITS)))
+s16 F16_toInt(fix16 value);
+fix16 F16_mul(fix16 val1, fix16 val2);
+fix16 F16_div(fix16 val1, fix16 val2);
+fix16 sinFix16(u16 value);
+fix16 cosFix16(u16 value);
+
+/* SISTEMA */
+#define TIMEPERSECOND 256
+extern vu32 vtimer;
+bool SYS_doVBlankProcess(void);
+void SYS_setVBlankCallback(VoidCallback *CB);
+void SYS_hardReset(void);
+u16 SYS_getCPULoad(void);
+bool SYS_isPAL(void);
+u32 getTick(void);
+u32 getTime(u16 fromTick);
+void waitMs(u32 ms);
+void setRandomSeed(u16 seed);
+u16 random(void);
+int kprintf(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+int sprintf(char *buffer, const char *fmt, ...);
+void KLog(char* text);
+void MEM_free(void *ptr);
+
+/* DMA */
+typedef enum {
+    CPU = 0,
+    DMA = 1,
+    DMA_QUEUE = 2,
+    DMA_QUEUE_COPY = 3
+} TransferMethod;
+#define DMA_VRAM 0
+#define DMA_CRAM 1
+#define DMA_VSRAM 2
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step);
+u16 DMA_getQueueTransferSize(void);
+
+/* VDP */
+typedef enum {
+    BG_A = 0, BG_B = 1, WINDOW = 2
+} VDPPlane;
+
+#define PAL0 0
+#define PAL1 1
+#define PAL2 2
+#define PAL3 3
+
+#define TILE_SIZE 32
+#define TILE_SYSTEM_INDEX 0x0000
+#define TILE_SYSTEM_LENGTH 16
+#define TILE_USER_INDEX (TILE_SYSTEM_INDEX + TILE_SYSTEM_LENGTH)
+#define TILE_MAX_NUM (0xC000 / TILE_SIZE)
+#define FONT_LEN 96
+#define TILE_FONT_INDEX (TILE_MAX_NUM - FONT_LEN)
+#define SPR_DEFAULT_VRAM_SIZE 420
+#define TILE_SPRITE_INDEX (TILE_FONT_INDEX - SPR_DEFAULT_VRAM_SIZE)
+
+#define HSCROLL_PLANE 0
+#define HSCROLL_TILE 2
+#define HSCROLL_LINE 3
+#define VSCROLL_PLANE 0
+#define VSCROLL_COLUMN 1
+
+#define TILE_ATTR_PRIORITY_SFT 15
+#define TILE_ATTR_PALETTE_SFT 13
+#define TILE_ATTR_VFLIP_SFT 12
+#define TILE_ATTR_HFLIP_SFT 11
+#define TILE_ATTR(pal, prio, flipV, flipH) (((flipH) << TILE_ATTR_HFLIP_SFT) + ((flipV) << TILE_ATTR_VFLIP_SFT) + ((pal) << TILE_ATTR_PALETTE_SFT) + ((prio) << TILE_ATTR_PRIORITY_SFT))
+#define TILE_ATTR_FULL(pal, prio, flipV, flipH, index) (((flipH) << TILE_ATTR_HFLIP_SFT) + ((flipV) << TILE_ATTR_VFLIP_SFT) + ((pal) << TILE_ATTR_PALETTE_SFT) + ((prio) << TILE_ATTR_PRIORITY_SFT) + (index))
+
+#define COMPRESSION_NONE 0
+
+typedef struct {
+    u16 compression;
+    u16 numTile;
+    u32 *tiles;
+} TileSet;
+
+typedef struct {
+    u16 compression;
+    u16 w;
+    u16 h;
+    u16 *tilemap;
+} TileMap;
+
+typedef struct {
+    u16 length;
+    u16* data;
+} Palette;
+
+typedef struct {
+    Palette *palette;
+    TileSet *tileset;
+    TileMap *tilemap;
+} Image;
+
+void VDP_init(void);
+void VDP_setScreenWidth320(void);
+void VDP_setScreenHeight224(void);
+void VDP_setPlaneSize(u16 w, u16 h, bool setupVram);
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll);
+void VDP_setBackgroundColor(u8 value);
+u16 VDP_getAdjustedVCounter(void);
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value);
+void VDP_setHorizontalScrollTile(VDPPlane plane, u16 tile, s16* values, u16 len, TransferMethod tm);
+void VDP_setHorizontalScrollLine(VDPPlane plane, u16 line, s16* values, u16 len, TransferMethod tm);
+void VDP_setVerticalScroll(VDPPlane plane, s16 value);
+void VDP_setWindowVPos(bool down, u16 pos);
+void VDP_clearPlane(VDPPlane plane, bool wait);
+void VDP_setTextPlane(VDPPlane plane);
+void VDP_setTextPalette(u16 palette);
+void VDP_drawTextBG(VDPPlane plane, const char* str, u16 x, u16 y);
+void VDP_clearTextBG(VDPPlane plane, u16 x, u16 y, u16 w);
+void VDP_drawText(const char* str, u16 x, u16 y);
+void VDP_clearText(u16 x, u16 y, u16 w);
+void VDP_clearTextArea(u16 x, u16 y, u16 w, u16 h);
+bool VDP_drawImageEx(VDPPlane plane, const Image *image, u16 basetile, u16 x, u16 y, bool loadpal, bool dma);
+void VDP_resetSprites(void);
+void VDP_releaseAllSprites(void);
+void VDP_loadTileData(const u32 *data, u16 index, u16 num, TransferMethod tm);
+bool VDP_loadTileSet(const TileSet *tileset, u16 index, TransferMethod tm);
+TileSet* unpackTileSet(const TileSet *src, TileSet *dest);
+bool VDP_loadFont(const TileSet *font, TransferMethod tm);
+void VDP_setTileMapXY(VDPPlane plane, u16 tile, u16 x, u16 y);
+void VDP_setTileMapDataRectEx(VDPPlane plane, const u16 *data, u16 basetile, u16 x, u16 y, u16 w, u16 h, u16 wm, TransferMethod tm);
+
+/* PALETAS */
+void PAL_getColors(u16 index, u16* dest, u16 count);
+void PAL_setColors(u16 index, const u16* pal, u16 count, TransferMethod tm);
+void PAL_setPalette(u16 numPal, const u16* pal, TransferMethod tm);
+bool PAL_initFade(u16 fromCol, u16 toCol, const u16* palSrc, const u16* palDst, u16 numFrame);
+bool PAL_doFadeStep(void);
+void PAL_fade(u16 fromCol, u16 toCol, const u16* palSrc, const u16* palDst, u16 numFrame, bool async);
+void PAL_fadeOutAll(u16 numFrame, bool async);
+bool PAL_isDoingFade(void);
+void PAL_interruptFade(void);
+
+/* MAPAS */
+typedef struct {
+    u16 w;
+    u16 h;
+    u16 hp;
+    u16 compression;
+    u16 numMetaTile;
+    u16 numBlock;
+    u16 *metaTiles;
+    void* blocks;
+    void* blockIndexes;
+    u16* blockRowOffsets;
+} MapDefinition;
+
+typedef struct Map {
+    const MapDefinition *def;
+    VDPPlane plane;
+    u16 baseTile;
+    u32 posX;
+    u32 posY;
+} Map;
+
+Map* MAP_create(const MapDefinition* mapDef, VDPPlane plane, u16 baseTile);
+void MAP_release(Map* map);
+void MAP_scrollTo(Map* map, u32 x, u32 y);
+void MAP_scrollToEx(Map* map, u32 x, u32 y, bool forceRedraw);
+void MAP_getTilemapRect(Map* map, u16 x, u16 y, u16 w, u16 h, bool column, u16* dest);
+
+/* SPRITES */
+#define SPR_MIN_DEPTH (-0x8000)
+#define SPR_MAX_DEPTH 0x7FFF
+
+typedef enum {
+    VISIBLE,
+    HIDDEN,
+    AUTO_FAST,
+    AUTO_SLOW,
+} SpriteVisibility;
+
+typedef struct {
+    s8 numSprite;
+    u8 timer;
+    TileSet* tileset;
+    void* collision;
+} AnimationFrame;
+
+typedef struct {
+    u8 numFrame;
+    u8 loop;
+    AnimationFrame** frames;
+} Animation;
+
+typedef struct {
+    u16 w;
+    u16 h;
+    Palette* palette;
+    u16 numAnimation;
+    Animation** animations;
+    u16 maxNumTile;
+    u16 maxNumSprite;
+} SpriteDefinition;
+
+typedef struct Sprite {
+    u16 status;
+    u16 visibility;
+    const SpriteDefinition* definition;
+    void (*onFrameChange)(struct Sprite* sprite);
+    Animation* animation;
+    AnimationFrame* frame;
+    s16 animInd;
+    s16 frameInd;
+    s16 timer;
+    s16 x;
+    s16 y;
+    s16 depth;
+    u16 attribut;
+    u32 data;
+    struct Sprite* prev;
+    struct Sprite* next;
+} Sprite;
+
+typedef void FrameChangeCallback(Sprite* sprite);
+
+void SPR_init(void);
+void SPR_end(void);
+void SPR_reset(void);
+Sprite* SPR_addSprite(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut);
+Sprite* SPR_addSpriteSafe(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut);
+void SPR_releaseSprite(Sprite* sprite);
+u16 SPR_getNumActiveSprite(void);
+u16 SPR_getUsedVDPSprite(void);
+bool SPR_setDefinition(Sprite* sprite, const SpriteDefinition* spriteDef);
+void SPR_setPosition(Sprite* sprite, s16 x, s16 y);
+void SPR_setHFlip(Sprite* sprite, bool value);
+void SPR_setDepth(Sprite* sprite, s16 value);
+void SPR_setAnimAndFrame(Sprite* sprite, s16 anim, s16 frame);
+void SPR_setAnim(Sprite* sprite, s16 anim);
+void SPR_setFrame(Sprite* sprite, s16 frame);
+void SPR_setAutoAnimation(Sprite* sprite, bool value);
+void SPR_setAnimationLoop(Sprite* sprite, bool value);
+bool SPR_isAnimationDone(Sprite* sprite);
+void SPR_setFrameChangeCallback(Sprite* sprite, FrameChangeCallback* callback);
+void SPR_setVisibility(Sprite* sprite, SpriteVisibility value);
+void SPR_update(void);
+
+/* MANDOS */
+#define JOY_1 0x0000
+#define JOY_2 0x0001
+#define JOY_ALL 0xFFFF
+#define BUTTON_UP 0x0001
+#define BUTTON_DOWN 0x0002
+#define BUTTON_LEFT 0x0004
+#define BUTTON_RIGHT 0x0008
+#define BUTTON_A 0x0040
+#define BUTTON_B 0x0010
+#define BUTTON_C 0x0020
+#define BUTTON_START 0x0080
+#define BUTTON_X 0x0400
+#define BUTTON_Y 0x0200
+#define BUTTON_Z 0x0100
+#define BUTTON_MODE 0x0800
+#define BUTTON_DIR 0x000F
+#define BUTTON_BTN 0x0FF0
+#define BUTTON_ALL 0x0FFF
+
+typedef void JoyEventCallback(u16 joy, u16 changed, u16 state);
+void JOY_init(void);
+void JOY_setEventHandler(JoyEventCallback *CB);
+u16 JOY_readJoypad(u16 joy);
+u16 JOY_waitPress(u16 joy, u16 btn);
+
+/* SRAM */
+void SRAM_enable(void);
+void SRAM_enableRO(void);
+void SRAM_disable(void);
+u8 SRAM_readByte(u32 offset);
+u16 SRAM_readWord(u32 offset);
+void SRAM_writeByte(u32 offset, u8 val);
+void SRAM_writeWord(u32 offset, u16 val);
+
+/* AUDIO */
+typedef enum {
+    SOUND_PCM_CH_AUTO = -1,
+    SOUND_PCM_CH1 = 0,
+    SOUND_PCM_CH2 = 1,
+    SOUND_PCM_CH3 = 2,
+} SoundPCMChannel;
+
+void Z80_init(void);
+void XGM2_loadDriver(bool waitReady);
+bool XGM2_isPlaying(void);
+void XGM2_play(const u8* song);
+void XGM2_stop(void);
+bool XGM2_playPCM(const u8 *sample, const u32 len, const SoundPCMChannel channel);
+void XGM2_fadeOut(const u16 numFrame);
+void XGM2_fadeOutAndStop(const u16 numFrame);
+void XGM2_setLoopNumber(const s8 value);
+void XGM2_setFMVolume(const u16 value);
+void XGM2_setPSGVolume(const u16 value);
+
+#endif
@@ -0,0 +1,11 @@
+/**
+ * @file kdebug.h
+ * @brief Stub de kdebug.h de SGDK para la build de host.
+ */
+#ifndef _HOST_KDEBUG_H_
+#define _HOST_KDEBUG_H_
+
+void KDebug_Alert(const char *str);
+void KDebug_AlertNumber(u32 nVal);
+
+#endif
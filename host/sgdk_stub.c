@@ -0,0 +1,549 @@
+/**
+ * @file sgdk_stub.c
+ * @brief Implementación en host de la API SGDK usada por el juego.
+ *
+ * Ninguna función toca hardware. Las llamadas a SPR_*, MAP_*, VDP_*, PAL_*,
+ * DMA_* y XGM2_* se cuentan por función para medir cuántas hace cada frame
+ * la lógica de los minijuegos. Los sprites viven en un pool fijo y SPR_update
+ * avanza sus animaciones igual que SGDK para que los callbacks de cambio de
+ * frame y SPR_isAnimationDone funcionen.
+ */
+#include <genesis.h>
+#include <kdebug.h>
+#include <math.h>
+#include <stdarg.h>
+
+#include "host_stub.h"
+
+#define HOST_MAX_SPRITES 128        /**< Igual que el límite de sprites hardware + margen. */
+#define HOST_MAX_MAPS 4             /**< Mapas MAP_create activos a la vez. */
+#define HOST_FRAME_LINES 262        /**< Líneas por frame NTSC. */
+#define HOST_VINT_LINE 224          /**< Línea de la VInt (modo V28): aquí sube vtimer. */
+#define HOST_VBLANK_WORK_LINES 8    /**< Líneas que gasta SYS_doVBlankProcess tras la VInt. */
+
+#define SPR_STATUS_ACTIVE    0x0001 /**< Slot del pool en uso. */
+#define SPR_STATUS_NO_AUTO   0x0002 /**< Animación automática desactivada. */
+#define SPR_STATUS_NO_LOOP   0x0004 /**< Animación sin bucle (se detiene en el último frame). */
+#define SPR_STATUS_DONE      0x0008 /**< Animación sin bucle terminada. */
+#define SPR_STATUS_FRAME_CHG 0x0010 /**< Frame cambiado pendiente de notificar. */
+
+/** @brief Cuenta una llamada a la función actual. */
+#define HOST_CALL() do { static HostCallSite site = { __func__, 0, FALSE, NULL }; hostStub_count(&site); } while (0)
+
+vu32 vtimer = 0;
+
+static HostCallSite *callSites = NULL;
+static Sprite spritePool[HOST_MAX_SPRITES];
+static Map mapPool[HOST_MAX_MAPS];
+static u16 joyState = 0;
+static JoyEventCallback *joyCallback = NULL;
+static VoidCallback *vblankCallback = NULL;
+static u16 randomState = 0x1234;
+static u16 fadeRemaining = 0;
+static bool fadeAsync = FALSE;   /**< Fundido avanzado por el VBlank (PAL_fade async) o a mano (PAL_doFadeStep). */
+static u16 beamLine = 0;          /**< Línea del haz simulado (contador V ajustado). */
+static u8 sram[0x2000];
+
+/* ------------------------------------------------------------------------- */
+/* Control del banco de pruebas                                              */
+/* ------------------------------------------------------------------------- */
+
+void hostStub_count(HostCallSite *site) {
+    if (!site->linked) {
+        site->linked = TRUE;
+        site->next = callSites;
+        callSites = site;
+    }
+    site->count++;
+}
+
+void hostStub_reset(void) {
+    for (HostCallSite *site = callSites; site != NULL; site = site->next) {
+        site->count = 0;
+    }
+    memset(spritePool, 0, sizeof(spritePool));
+    memset(mapPool, 0, sizeof(mapPool));
+    joyState = 0;
+    joyCallback = NULL;
+    vblankCallback = NULL;
+    fadeRemaining = 0;
+    beamLine = 0;
+    vtimer = 0;
+}
+
+void hostStub_advanceBeam(u16 lines) {
+    while (lines--) {
+        if (++beamLine >= HOST_FRAME_LINES) beamLine = 0;
+        if (beamLine == HOST_VINT_LINE) vtimer++;
+    }
+}
+
+void hostStub_setJoypad(u16 state) {
+    const u16 changed = joyState ^ state;
+    joyState = state;
+    if (changed && joyCallback != NULL) {
+        joyCallback(JOY_1, changed, state);
+    }
+}
+
+u32 hostStub_getFrames(void) {
+    return vtimer;
+}
+
+const HostCallSite* hostStub_getCallSites(void) {
+    return callSites;
+}
+
+u32 hostStub_getCallsByPrefix(const char *prefix) {
+    const size_t len = strlen(prefix);
+    u32 total = 0;
+    for (const HostCallSite *site = callSites; site != NULL; site = site->next) {
+        if (strncmp(site->name, prefix, len) == 0) total += site->count;
+    }
+    return total;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Matemáticas                                                               */
+/* ------------------------------------------------------------------------- */
+
+s16 F16_toInt(fix16 value) {
+    return value >> FIX16_FRAC_BITS;
+}
+
+fix16 F16_mul(fix16 val1, fix16 val2) {
+    return (fix16)(((s32)val1 * (s32)val2) >> FIX16_FRAC_BITS);
+}
+
+fix16 F16_div(fix16 val1, fix16 val2) {
+    if (val2 == 0) return 0;
+    return (fix16)(((s32)val1 << FIX16_FRAC_BITS) / val2);
+}
+
+fix16 sinFix16(u16 value) {
+    return (fix16)lround(sin((value & 1023) * (2.0 * M_PI / 1024.0)) * (1 << FIX16_FRAC_BITS));
+}
+
+fix16 cosFix16(u16 value) {
+    return sinFix16(value + 256);
+}
+
+/* ------------------------------------------------------------------------- */
+/* Sistema                                                                   */
+/* ------------------------------------------------------------------------- */
+
+bool SYS_doVBlankProcess(void) {
+    /* Espera a la siguiente VInt y vuelve ya dentro del VBlank, como en consola. */
+    const u32 frame = vtimer;
+    while (vtimer == frame) hostStub_advanceBeam(1);
+    hostStub_advanceBeam(HOST_VBLANK_WORK_LINES);
+    if (vblankCallback != NULL) vblankCallback();
+    if (fadeAsync && fadeRemaining > 0) fadeRemaining--;
+    return TRUE;
+}
+
+void SYS_setVBlankCallback(VoidCallback *CB) { vblankCallback = CB; }
+/* En host no hay reinicio: se vuelve al llamador y el minijuego queda completado. */
+void SYS_hardReset(void) { HOST_CALL(); }
+u16 SYS_getCPULoad(void) { return 0; }
+bool SYS_isPAL(void) { return FALSE; }
+u32 getTick(void) { return vtimer * (TIMEPERSECOND / 60); }
+u32 getTime(u16 fromTick) { return fromTick ? getTick() : getTick() / TIMEPERSECOND; }
+void waitMs(u32 ms) { (void)ms; }
+
+void setRandomSeed(u16 seed) {
+    randomState = seed ? seed : 1;
+}
+
+u16 random(void) {
+    /* xorshift de 16 bits: determinista y suficiente para el banco. */
+    randomState ^= randomState << 7;
+    randomState ^= randomState >> 9;
+    randomState ^= randomState << 8;
+    return randomState;
+}
+
+int kprintf(const char *fmt, ...) {
+    (void)fmt;
+    return 0;
+}
+
+void KLog(char* text) { (void)text; }
+void KDebug_Alert(const char *str) { (void)str; }
+void KDebug_AlertNumber(u32 nVal) { (void)nVal; }
+void MEM_free(void *ptr) { (void)ptr; }
+
+/* ------------------------------------------------------------------------- */
+/* DMA                                                                       */
+/* ------------------------------------------------------------------------- */
+
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step) {
+    (void)location; (void)from; (void)to; (void)len; (void)step;
+    HOST_CALL();
+    return TRUE;
+}
+
+u16 DMA_getQueueTransferSize(void) { return 0; }
+
+/* ------------------------------------------------------------------------- */
+/* VDP                                                                       */
+/* ------------------------------------------------------------------------- */
+
+u16 VDP_getAdjustedVCounter(void) {
+    /* Sin reloj real: cada consulta avanza una línea para que el planificador
+     * vea un coste no nulo y estable. El haz sigue hasta el final del VBlank
+     * antes de volver a 0, igual que el contador ajustado de SGDK. */
+    hostStub_advanceBeam(1);
+    return beamLine;
+}
+
+void VDP_init(void) { HOST_CALL(); }
+void VDP_setScreenWidth320(void) { HOST_CALL(); }
+void VDP_setScreenHeight224(void) { HOST_CALL(); }
+void VDP_setPlaneSize(u16 w, u16 h, bool setupVram) { (void)w; (void)h; (void)setupVram; HOST_CALL(); }
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll) { (void)hscroll; (void)vscroll; HOST_CALL(); }
+void VDP_setBackgroundColor(u8 value) { (void)value; HOST_CALL(); }
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value) { (void)plane; (void)value; HOST_CALL(); }
+void VDP_setHorizontalScrollTile(VDPPlane plane, u16 tile, s16* values, u16 len, TransferMethod tm) {
+    (void)plane; (void)tile; (void)values; (void)len; (void)tm; HOST_CALL();
+}
+void VDP_setHorizontalScrollLine(VDPPlane plane, u16 line, s16* values, u16 len, TransferMethod tm) {
+    (void)plane; (void)line; (void)values; (void)len; (void)tm; HOST_CALL();
+}
+void VDP_setVerticalScroll(VDPPlane plane, s16 value) { (void)plane; (void)value; HOST_CALL(); }
+void VDP_setWindowVPos(bool down, u16 pos) { (void)down; (void)pos; HOST_CALL(); }
+void VDP_clearPlane(VDPPlane plane, bool wait) { (void)plane; (void)wait; HOST_CALL(); }
+void VDP_setTextPlane(VDPPlane plane) { (void)plane; HOST_CALL(); }
+void VDP_setTextPalette(u16 palette) { (void)palette; HOST_CALL(); }
+void VDP_drawTextBG(VDPPlane plane, const char* str, u16 x, u16 y) { (void)plane; (void)str; (void)x; (void)y; HOST_CALL(); }
+void VDP_clearTextBG(VDPPlane plane, u16 x, u16 y, u16 w) { (void)plane; (void)x; (void)y; (void)w; HOST_CALL(); }
+void VDP_drawText(const char* str, u16 x, u16 y) { (void)str; (void)x; (void)y; HOST_CALL(); }
+void VDP_clearText(u16 x, u16 y, u16 w) { (void)x; (void)y; (void)w; HOST_CALL(); }
+void VDP_clearTextArea(u16 x, u16 y, u16 w, u16 h) { (void)x; (void)y; (void)w; (void)h; HOST_CALL(); }
+bool VDP_drawImageEx(VDPPlane plane, const Image *image, u16 basetile, u16 x, u16 y, bool loadpal, bool dma) {
+    (void)plane; (void)image; (void)basetile; (void)x; (void)y; (void)loadpal; (void)dma;
+    HOST_CALL();
+    return TRUE;
+}
+void VDP_resetSprites(void) { HOST_CALL(); }
+void VDP_releaseAllSprites(void) { HOST_CALL(); }
+void VDP_loadTileData(const u32 *data, u16 index, u16 num, TransferMethod tm) {
+    (void)data; (void)index; (void)num; (void)tm; HOST_CALL();
+}
+bool VDP_loadTileSet(const TileSet *tileset, u16 index, TransferMethod tm) {
+    (void)tileset; (void)index; (void)tm;
+    HOST_CALL();
+    return TRUE;
+}
+/* Los recursos del host no están comprimidos: la "copia" comparte los tiles
+ * y sale de un anillo fijo, así que MEM_free no tiene nada que liberar. */
+TileSet* unpackTileSet(const TileSet *src, TileSet *dest) {
+    static TileSet unpacked[8];
+    static u8 next = 0;
+    HOST_CALL();
+    if (dest == NULL) dest = &unpacked[next++ & 7];
+    *dest = *src;
+    return dest;
+}
+bool VDP_loadFont(const TileSet *font, TransferMethod tm) { (void)font; (void)tm; HOST_CALL(); return TRUE; }
+void VDP_setTileMapXY(VDPPlane plane, u16 tile, u16 x, u16 y) { (void)plane; (void)tile; (void)x; (void)y; HOST_CALL(); }
+void VDP_setTileMapDataRectEx(VDPPlane plane, const u16 *data, u16 basetile, u16 x, u16 y, u16 w, u16 h, u16 wm, TransferMethod tm) {
+    (void)plane; (void)data; (void)basetile; (void)x; (void)y; (void)w; (void)h; (void)wm; (void)tm; HOST_CALL();
+}
+
+/* ------------------------------------------------------------------------- */
+/* Paletas                                                                   */
+/* ------------------------------------------------------------------------- */
+
+void PAL_getColors(u16 index, u16* dest, u16 count) {
+    (void)index;
+    HOST_CALL();
+    if (dest != NULL) memset(dest, 0, count * sizeof(u16));
+}
+void PAL_setColors(u16 index, const u16* pal, u16 count, TransferMethod tm) { (void)index; (void)pal; (void)count; (void)tm; HOST_CALL(); }
+void PAL_setPalette(u16 numPal, const u16* pal, TransferMethod tm) { (void)numPal; (void)pal; (void)tm; HOST_CALL(); }
+bool PAL_initFade(u16 fromCol, u16 toCol, const u16* palSrc, const u16* palDst, u16 numFrame) {
+    (void)fromCol; (void)toCol; (void)palSrc; (void)palDst;
+    HOST_CALL();
+    fadeRemaining = numFrame;
+    fadeAsync = FALSE;
+    return TRUE;
+}
+bool PAL_doFadeStep(void) {
+    HOST_CALL();
+    if (fadeRemaining > 0) fadeRemaining--;
+    return fadeRemaining > 0;
+}
+void PAL_fade(u16 fromCol, u16 toCol, const u16* palSrc, const u16* palDst, u16 numFrame, bool async) {
+    (void)fromCol; (void)toCol; (void)palSrc; (void)palDst;
+    HOST_CALL();
+    fadeRemaining = async ? numFrame : 0;
+    fadeAsync = async;
+}
+void PAL_fadeOutAll(u16 numFrame, bool async) {
+    HOST_CALL();
+    fadeRemaining = async ? numFrame : 0;
+    fadeAsync = async;
+}
+bool PAL_isDoingFade(void) { return fadeRemaining > 0; }
+void PAL_interruptFade(void) { HOST_CALL(); fadeRemaining = 0; }
+
+/* ------------------------------------------------------------------------- */
+/* Mapas                                                                     */
+/* ------------------------------------------------------------------------- */
+
+Map* MAP_create(const MapDefinition* mapDef, VDPPlane plane, u16 baseTile) {
+    HOST_CALL();
+    for (u16 i = 0; i < HOST_MAX_MAPS; i++) {
+        if (mapPool[i].def == NULL) {
+            mapPool[i].def = mapDef;
+            mapPool[i].plane = plane;
+            mapPool[i].baseTile = baseTile;
+            mapPool[i].posX = 0;
+            mapPool[i].posY = 0;
+            return &mapPool[i];
+        }
+    }
+    return NULL;
+}
+
+void MAP_release(Map* map) {
+    HOST_CALL();
+    if (map != NULL) memset(map, 0, sizeof(Map));
+}
+
+void MAP_scrollTo(Map* map, u32 x, u32 y) {
+    HOST_CALL();
+    if (map == NULL) return;
+    map->posX = x;
+    map->posY = y;
+}
+
+void MAP_scrollToEx(Map* map, u32 x, u32 y, bool forceRedraw) {
+    (void)forceRedraw;
+    MAP_scrollTo(map, x, y);
+}
+
+void MAP_getTilemapRect(Map* map, u16 x, u16 y, u16 w, u16 h, bool column, u16* dest) {
+    (void)map; (void)x; (void)y; (void)column;
+    HOST_CALL();
+    if (dest != NULL) memset(dest, 0, w * h * sizeof(u16));
+}
+
+/* ------------------------------------------------------------------------- */
+/* Sprites                                                                   */
+/* ------------------------------------------------------------------------- */
+
+/** @brief Selecciona animación/frame válidos dentro de la definición del sprite. */
+static void applyAnimFrame(Sprite* sprite, s16 anim, s16 frame) {
+    const SpriteDefinition *def = sprite->definition;
+    if (def == NULL || def->numAnimation == 0) return;
+    if (anim < 0 || anim >= (s16)def->numAnimation) anim = 0;
+    Animation *animation = def->animations[anim];
+    if (frame < 0 || frame >= animation->numFrame) frame = 0;
+
+    if (sprite->animInd != anim || sprite->frameInd != frame || sprite->animation != animation) {
+        sprite->status |= SPR_STATUS_FRAME_CHG;
+    }
+    sprite->animInd = anim;
+    sprite->animation = animation;
+    sprite->frameInd = frame;
+    sprite->frame = animation->frames[frame];
+    sprite->timer = sprite->frame->timer;
+    sprite->status &= ~SPR_STATUS_DONE;
+}
+
+void SPR_init(void) { HOST_CALL(); memset(spritePool, 0, sizeof(spritePool)); }
+void SPR_end(void) { HOST_CALL(); memset(spritePool, 0, sizeof(spritePool)); }
+void SPR_reset(void) { HOST_CALL(); memset(spritePool, 0, sizeof(spritePool)); }
+
+Sprite* SPR_addSprite(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut) {
+    HOST_CALL();
+    for (u16 i = 0; i < HOST_MAX_SPRITES; i++) {
+        Sprite *sprite = &spritePool[i];
+        if (sprite->status & SPR_STATUS_ACTIVE) continue;
+        memset(sprite, 0, sizeof(Sprite));
+        sprite->status = SPR_STATUS_ACTIVE;
+        sprite->definition = spriteDef;
+        sprite->x = x;
+        sprite->y = y;
+        sprite->attribut = attribut;
+        sprite->visibility = VISIBLE;
+        sprite->animInd = -1;
+        applyAnimFrame(sprite, 0, 0);
+        if (spriteDef != NULL && spriteDef->numAnimation > 0 && !spriteDef->animations[0]->loop) {
+            sprite->status |= SPR_STATUS_NO_LOOP;
+        }
+        return sprite;
+    }
+    return NULL;
+}
+
+Sprite* SPR_addSpriteSafe(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut) {
+    return SPR_addSprite(spriteDef, x, y, attribut);
+}
+
+void SPR_releaseSprite(Sprite* sprite) {
+    HOST_CALL();
+    if (sprite != NULL) sprite->status = 0;
+}
+
+u16 SPR_getNumActiveSprite(void) {
+    u16 count = 0;
+    for (u16 i = 0; i < HOST_MAX_SPRITES; i++) {
+        if (spritePool[i].status & SPR_STATUS_ACTIVE) count++;
+    }
+    return count;
+}
+
+u16 SPR_getUsedVDPSprite(void) { return SPR_getNumActiveSprite(); }
+
+bool SPR_setDefinition(Sprite* sprite, const SpriteDefinition* spriteDef) {
+    HOST_CALL();
+    if (sprite == NULL) return FALSE;
+    if (sprite->definition != spriteDef) {
+        sprite->definition = spriteDef;
+        sprite->animInd = -1;
+        applyAnimFrame(sprite, 0, 0);
+    }
+    return TRUE;
+}
+
+void SPR_setPosition(Sprite* sprite, s16 x, s16 y) {
+    HOST_CALL();
+    if (sprite == NULL) return;
+    sprite->x = x;
+    sprite->y = y;
+}
+
+void SPR_setHFlip(Sprite* sprite, bool value) {
+    HOST_CALL();
+    if (sprite == NULL) return;
+    if (value) sprite->attribut |= TILE_ATTR(0, 0, 0, 1);
+    else sprite->attribut &= ~TILE_ATTR(0, 0, 0, 1);
+}
+
+void SPR_setDepth(Sprite* sprite, s16 value) {
+    HOST_CALL();
+    if (sprite != NULL) sprite->depth = value;
+}
+
+void SPR_setAnimAndFrame(Sprite* sprite, s16 anim, s16 frame) {
+    HOST_CALL();
+    if (sprite != NULL) applyAnimFrame(sprite, anim, frame);
+}
+
+void SPR_setAnim(Sprite* sprite, s16 anim) {
+    HOST_CALL();
+    if (sprite == NULL || sprite->animInd == anim) return;
+    applyAnimFrame(sprite, anim, 0);
+}
+
+void SPR_setFrame(Sprite* sprite, s16 frame) {
+    HOST_CALL();
+    if (sprite != NULL) applyAnimFrame(sprite, sprite->animInd, frame);
+}
+
+void SPR_setAutoAnimation(Sprite* sprite, bool value) {
+    HOST_CALL();
+    if (sprite == NULL) return;
+    if (value) sprite->status &= ~SPR_STATUS_NO_AUTO;
+    else sprite->status |= SPR_STATUS_NO_AUTO;
+}
+
+void SPR_setAnimationLoop(Sprite* sprite, bool value) {
+    HOST_CALL();
+    if (sprite == NULL) return;
+    if (value) sprite->status &= ~SPR_STATUS_NO_LOOP;
+    else sprite->status |= SPR_STATUS_NO_LOOP;
+}
+
+bool SPR_isAnimationDone(Sprite* sprite) {
+    HOST_CALL();
+    return (sprite != NULL) && (sprite->status & SPR_STATUS_DONE);
+}
+
+void SPR_setFrameChangeCallback(Sprite* sprite, FrameChangeCallback* callback) {
+    HOST_CALL();
+    if (sprite != NULL) sprite->onFrameChange = callback;
+}
+
+void SPR_setVisibility(Sprite* sprite, SpriteVisibility value) {
+    HOST_CALL();
+    if (sprite != NULL) sprite->visibility = value;
+}
+
+/** @brief Avanza la animación automática de un sprite (mismo orden que SGDK). */
+static void updateSpriteAnimation(Sprite* sprite) {
+    if ((sprite->status & (SPR_STATUS_NO_AUTO | SPR_STATUS_DONE)) || sprite->animation == NULL) return;
+    if (sprite->frame == NULL || sprite->frame->timer == 0) return;
+    if (--sprite->timer > 0) return;
+
+    s16 next = sprite->frameInd + 1;
+    if (next >= sprite->animation->numFrame) {
+        if (sprite->status & SPR_STATUS_NO_LOOP) {
+            sprite->status |= SPR_STATUS_DONE;
+            sprite->timer = sprite->frame->timer;
+            return;
+        }
+        next = 0;
+    }
+    sprite->frameInd = next;
+    sprite->frame = sprite->animation->frames[next];
+    sprite->timer = sprite->frame->timer;
+    sprite->status |= SPR_STATUS_FRAME_CHG;
+}
+
+void SPR_update(void) {
+    HOST_CALL();
+    for (u16 i = 0; i < HOST_MAX_SPRITES; i++) {
+        Sprite *sprite = &spritePool[i];
+        if (!(sprite->status & SPR_STATUS_ACTIVE)) continue;
+        updateSpriteAnimation(sprite);
+        if (sprite->status & SPR_STATUS_FRAME_CHG) {
+            sprite->status &= ~SPR_STATUS_FRAME_CHG;
+            if (sprite->onFrameChange != NULL) sprite->onFrameChange(sprite);
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* Mandos                                                                    */
+/* ------------------------------------------------------------------------- */
+
+void JOY_init(void) { joyState = 0; }
+void JOY_setEventHandler(JoyEventCallback *CB) { joyCallback = CB; }
+u16 JOY_readJoypad(u16 joy) { (void)joy; return joyState; }
+u16 JOY_waitPress(u16 joy, u16 btn) { (void)joy; return btn; }
+
+/* ------------------------------------------------------------------------- */
+/* SRAM                                                                      */
+/* ------------------------------------------------------------------------- */
+
+void SRAM_enable(void) { }
+void SRAM_enableRO(void) { }
+void SRAM_disable(void) { }
+u8 SRAM_readByte(u32 offset) { return sram[offset % sizeof(sram)]; }
+u16 SRAM_readWord(u32 offset) { return (SRAM_readByte(offset) << 8) | SRAM_readByte(offset + 1); }
+void SRAM_writeByte(u32 offset, u8 val) { sram[offset % sizeof(sram)] = val; }
+void SRAM_writeWord(u32 offset, u16 val) { SRAM_writeByte(offset, val >> 8); SRAM_writeByte(offset + 1, val & 0xFF); }
+
+/* ------------------------------------------------------------------------- */
+/* Audio                                                                     */
+/* ------------------------------------------------------------------------- */
+
+void Z80_init(void) { }
+void XGM2_loadDriver(bool waitReady) { (void)waitReady; HOST_CALL(); }
+bool XGM2_isPlaying(void) { return FALSE; }
+void XGM2_play(const u8* song) { (void)song; HOST_CALL(); }
+void XGM2_stop(void) { HOST_CALL(); }
+bool XGM2_playPCM(const u8 *sample, const u32 len, const SoundPCMChannel channel) {
+    (void)sample; (void)len; (void)channel;
+    HOST_CALL();
+    return TRUE;
+}
+void XGM2_fadeOut(const u16 numFrame) { (void)numFrame; HOST_CALL(); }
+void XGM2_fadeOutAndStop(const u16 numFrame) { (void)numFrame; HOST_CALL(); }
+void XGM2_setLoopNumber(const s8 value) { (void)value; HOST_CALL(); }
+void XGM2_setFMVolume(const u16 value) { (void)value; HOST_CALL(); }
+void XGM2_setPSGVolume(const u16 value) { (void)value; HOST_CALL(); }
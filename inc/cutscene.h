@@ -8,13 +8,21 @@
  * @brief Escenas cortas previas a cada fase con fondo y texto progresivo.
  */
 
-/** @brief Reproduce la escena introductoria de la fase 1. */
-void cutscene_phase1_intro(void);
+/**
+ * @brief Precarga de la fase siguiente (p. ej. minigamePickup_preload).
+ *
+ * Se llama con el fondo de la escena ya dibujado; lo que encole en la cola de
+ * DMA se envía mientras se escribe el texto y termina antes de salir.
+ */
+typedef void CutscenePreloadCallback(void);
+
+/** @brief Reproduce la escena introductoria de la fase 1 precargando la fase (o NULL). */
+void cutscene_phase1_intro(CutscenePreloadCallback *preload);
 
-/** @brief Reproduce la escena introductoria de la fase 2. */
-void cutscene_phase2_intro(void);
+/** @brief Reproduce la escena introductoria de la fase 2 precargando la fase (o NULL). */
+void cutscene_phase2_intro(CutscenePreloadCallback *preload);
 
-/** @brief Reproduce la escena introductoria de la fase 3. */
-void cutscene_phase3_intro(void);
+/** @brief Reproduce la escena introductoria de la fase 3 precargando la fase (o NULL). */
+void cutscene_phase3_intro(CutscenePreloadCallback *preload);
 
 #endif
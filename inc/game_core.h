@@ -18,6 +18,15 @@
 // #define DEBUG_MODE
 // #endif
 
+/* Instrumentación (contadores, overlay y volcado KDebug): activa en builds DEBUG de SGDK. */
+#ifndef GAME_PROFILE
+#ifdef DEBUG
+#define GAME_PROFILE 1
+#else
+#define GAME_PROFILE 0
+#endif
+#endif
+
 /* PALETAS */
 #define PAL_COMMON 0
 #define PAL_PLAYER 1
@@ -34,8 +43,21 @@ typedef struct {
     s8 maxVelocity;      /**< Límite absoluto de velocidad por eje. */
 } GameInertia;
 
-/* TILESET INDEX GLOBAL */
-extern u32 globalTileIndex;
+/* VRAM DE TILES */
+#define GAME_VRAM_MAX_REGIONS 12    /* Regiones de tiles con nombre vivas a la vez. */
+#define GAME_VRAM_NONE 0xFFFF       /* Índice devuelto cuando no hay región. */
+#define GAME_VRAM_RESIDENT 0x01     /* La región sobrevive a gameCore_vramReleasePhase. */
+#define GAME_VRAM_PRELOAD 0x02      /* Sobrevive solo a la siguiente gameCore_vramReleasePhase. */
+
+/**
+ * @brief Región de tiles reservada en el área de usuario de la VRAM.
+ */
+typedef struct {
+    const char *name;  /**< Nombre del recurso (clave de búsqueda). */
+    u16 base;          /**< Primer tile de la región. */
+    u16 size;          /**< Número de tiles reservados (0 = hueco libre). */
+    u8 flags;          /**< GAME_VRAM_RESIDENT / GAME_VRAM_PRELOAD. */
+} GameVramRegion;
 
 /**
  * @brief Idiomas disponibles para los textos.
@@ -50,11 +72,62 @@ typedef enum {
  */
 extern GameLanguage g_selectedLanguage;
 
-/** @brief Reinicia el índice global de tiles al valor por defecto del usuario. */
-void gameCore_resetTileIndex(void);
+/**
+ * @brief Reserva tiles para un recurso de la fase actual.
+ *
+ * Busca el primer hueco libre desde TILE_USER_INDEX. Si la región invadiera el
+ * área de tiles del motor de sprites (TILE_SPRITE_INDEX) se avisa por KDebug.
+ *
+ * @param name Nombre del recurso (literal; se usa en avisos e informes).
+ * @param numTile Tiles a reservar.
+ * @return Primer tile de la región.
+ */
+u16 gameCore_vramAlloc(const char *name, u16 numTile);
+
+/**
+ * @brief Reserva (o recupera) tiles residentes que sobreviven al cambio de fase.
+ *
+ * Las regiones residentes se colocan desde el final del área de usuario para
+ * no fragmentar los huecos de las fases.
+ *
+ * @param name Nombre del recurso; si ya existe se devuelve la misma región.
+ * @param numTile Tiles a reservar.
+ * @param loaded Recibe TRUE si la región ya existía (sus tiles siguen en VRAM).
+ * @return Primer tile de la región.
+ */
+u16 gameCore_vramAllocResident(const char *name, u16 numTile, u8 *loaded);
+
+/** @brief Libera la región que empieza en base para que pueda reutilizarse. */
+void gameCore_vramFree(u16 base);
+
+/**
+ * @brief Libera todas las regiones no residentes (inicio de fase).
+ *
+ * Las regiones precargadas se conservan una vez y pasan a ser de fase.
+ */
+void gameCore_vramReleasePhase(void);
+
+/**
+ * @brief Busca una región por nombre.
+ * @return Primer tile o GAME_VRAM_NONE si no está reservada.
+ */
+u16 gameCore_vramFind(const char *name);
+
+/** @brief Tiles de usuario en uso ahora mismo. */
+u16 gameCore_vramGetUsed(void);
+
+/** @brief Pico de tiles en uso desde la última gameCore_vramReleasePhase. */
+u16 gameCore_vramGetHighWater(void);
+
+#if GAME_PROFILE
+/** @brief Vuelca por KDebug las regiones vivas y el pico de la fase (solo con GAME_PROFILE). */
+void gameCore_vramReport(void);
+#endif
 
 /**
  * @brief Limpia VRAM, planos y sprites para garantizar un inicio de fase limpio.
+ *
+ * Libera las regiones de tiles de la fase anterior; las residentes se conservan.
  */
 void gameCore_resetVideoState(void);
 
@@ -67,14 +140,130 @@ typedef struct {
     u8 state;          /**< 0=RUNNING, 1=VICTORY, 2=DEFEAT. */
 } GameTimer;
 
+/* ENTRADA: GRABACIÓN Y REPRODUCCIÓN */
+#define GAME_INPUT_MAX_RUNS 512       /* Tramos RLE que caben en la grabación (4 bytes cada uno). */
+#define GAME_INPUT_SRAM_OFFSET 0x0000 /* Offset en SRAM donde se guarda la grabación. */
+
+/**
+ * @brief Origen de la entrada que devuelve gameCore_readInput.
+ */
+typedef enum {
+    GAME_INPUT_LIVE = 0,   /**< Mando 1 en directo. */
+    GAME_INPUT_RECORD = 1, /**< Mando 1 en directo guardando cada frame. */
+    GAME_INPUT_REPLAY = 2  /**< Reproduce la grabación en lugar del mando. */
+} GameInputMode;
+
+/**
+ * @brief Tramo de la grabación: una máscara de botones repetida varios frames.
+ */
+typedef struct {
+    u16 buttons;   /**< Máscara de botones del tramo. */
+    u16 frames;    /**< Frames consecutivos con esa máscara. */
+} GameInputRun;
+
+/* ALEATORIOS */
+
+/**
+ * @brief Flujos aleatorios independientes (uno por minijuego).
+ *
+ * Cada minijuego consume solo su flujo, así que su secuencia no depende de
+ * cuántos números hayan pedido las fases anteriores.
+ */
+typedef enum {
+    GAME_RNG_PICKUP = 0,   /**< Fase 1: spawns, retardos y SFX de elfos. */
+    GAME_RNG_DELIVERY = 1, /**< Fase 2: chimeneas y enemigos. */
+    GAME_RNG_BELLS = 2,    /**< Fase 3: campanas, bombas y letras. */
+    GAME_RNG_STREAMS = 3   /**< Número de flujos. */
+} GameRngStream;
+
 /* FUNCIONES */
 
 /**
- * @brief Lee el estado del mando 1.
- * @return Máscara de botones según JOY_readJoypad.
+ * @brief Lee el estado del mando 1 a través del modo de entrada actual.
+ *
+ * La máscara se muestrea una sola vez por frame (vtimer): todas las lecturas
+ * del mismo frame devuelven el mismo valor, que es lo que se graba o reproduce.
+ *
+ * @return Máscara de botones según JOY_readJoypad o la grabación activa.
  */
 u16 gameCore_readInput(void);
 
+/**
+ * @brief Empieza a grabar la entrada y fija la semilla aleatoria.
+ * @param seed Semilla que se aplica ahora y se guarda con la grabación.
+ */
+void gameCore_startInputRecording(u16 seed);
+
+/**
+ * @brief Reproduce la grabación en memoria desde el principio.
+ *
+ * Aplica la semilla guardada. Si la grabación se agota antes de detener la
+ * captura, la entrada pasa a 0 (nunca al mando en directo) y
+ * gameCore_isInputTruncated lo indica.
+ *
+ * @return FALSE si no hay grabación.
+ */
+u8 gameCore_startInputReplay(void);
+
+/** @brief Detiene grabación o reproducción y vuelve al mando en directo. */
+void gameCore_stopInputCapture(void);
+
+/** @brief Modo de entrada actual. */
+GameInputMode gameCore_getInputMode(void);
+
+/** @brief Número de tramos RLE de la grabación en memoria. */
+u16 gameCore_getInputRunCount(void);
+
+/**
+ * @brief Indica si la captura no es repetible entera.
+ *
+ * Al grabar: se llenaron los GAME_INPUT_MAX_RUNS tramos y se dejó de grabar.
+ * Al reproducir: la grabación se acabó antes de detener la captura.
+ * Tras gameCore_loadInputRecording: la grabación guardada estaba cortada.
+ */
+u8 gameCore_isInputTruncated(void);
+
+/**
+ * @brief Guarda la grabación en memoria en SRAM.
+ * @return FALSE si no hay nada que guardar.
+ */
+u8 gameCore_saveInputRecording(void);
+
+/**
+ * @brief Carga en memoria una grabación guardada en SRAM.
+ * @return FALSE si la SRAM no contiene una grabación válida.
+ */
+u8 gameCore_loadInputRecording(void);
+
+/**
+ * @brief Fija la semilla base de la que derivan todos los flujos aleatorios.
+ * @param seed Semilla base (0 se sustituye por una constante no nula).
+ */
+void gameCore_seedRandom(u16 seed);
+
+/**
+ * @brief Vuelve a poner un flujo en su semilla derivada (al iniciar cada fase).
+ * @param stream Flujo a reiniciar.
+ */
+void gameCore_resetRandomStream(GameRngStream stream);
+
+/**
+ * @brief Siguiente número de 16 bits del flujo (xorshift, sin divisiones).
+ * @param stream Flujo a consumir.
+ */
+u16 gameCore_random(GameRngStream stream);
+
+/**
+ * @brief Número aleatorio en [0, range) sin división.
+ *
+ * Usa multiplicación y desplazamiento ((r * range) >> 16), un MULU de 16 bits
+ * en el 68000 en lugar del DIVU que genera el operador %.
+ *
+ * @param stream Flujo a consumir.
+ * @param range Número de valores posibles (0 devuelve 0).
+ */
+u16 gameCore_randomRange(GameRngStream stream, u16 range);
+
 /**
  * @brief Inicializa un temporizador en segundos.
  * @param timer Estructura a rellenar.
@@ -91,6 +280,8 @@ s32 gameCore_updateTimer(GameTimer *timer);
 
 /**
  * @brief Realiza un fundido a negro tanto en paletas como en audio.
+ *
+ * Bloquea hasta que termina, pero sigue procesando la cola de DMA cada frame.
  */
 void gameCore_fadeToBlack(void);
 
@@ -122,4 +313,697 @@ void gameCore_applyInertiaMovement(s16 *x, s16 *y, s8 *vx, s8 *vy,
  */
 u8 gameCore_checkCollision(s16 x1, s16 y1, s16 w1, s16 h1, s16 x2, s16 y2, s16 w2, s16 h2);
 
+/* REJILLA DE COLISIONES (BROADPHASE) */
+#define GAME_GRID_CELL_SHIFT 5        /* Celdas de 32x32 px. */
+#define GAME_GRID_COLS ((SCREEN_WIDTH + (1 << GAME_GRID_CELL_SHIFT) - 1) >> GAME_GRID_CELL_SHIFT)
+#define GAME_GRID_ROWS ((SCREEN_HEIGHT + (1 << GAME_GRID_CELL_SHIFT) - 1) >> GAME_GRID_CELL_SHIFT)
+#define GAME_GRID_MAX_ENTRIES 48      /* Cajas registradas por frame. */
+#define GAME_GRID_MAX_LINKS 128       /* Pares caja/celda (una caja puede ocupar varias celdas). */
+#define GAME_GRID_NONE 0xFF           /* Índice nulo de entrada o enlace. */
+
+/**
+ * @brief Caja registrada en la rejilla de colisiones.
+ *
+ * Las coordenadas son de pantalla; lo que queda fuera se asigna a las celdas
+ * del borde, así que también se detectan solapes parcialmente fuera de pantalla.
+ */
+typedef struct {
+    s16 x;         /**< Esquina superior izquierda X. */
+    s16 y;         /**< Esquina superior izquierda Y. */
+    s16 w;         /**< Ancho de la caja. */
+    s16 h;         /**< Alto de la caja. */
+    u8 layer;      /**< Bit de capa (definido por cada minijuego). */
+    u8 id;         /**< Índice de la entidad en los arrays del minijuego. */
+} GameGridEntry;
+
+/**
+ * @brief Vacía la rejilla de colisiones; se llama una vez por frame antes de registrar.
+ */
+void gameCore_gridClear(void);
+
+/**
+ * @brief Registra una caja en todas las celdas que toca.
+ * @param layer Bit de capa de la entidad.
+ * @param id Índice de la entidad en su minijuego.
+ * @return Índice de entrada o GAME_GRID_NONE si no caben la entrada o todos sus enlaces
+ *         (en ese caso no se registra nada).
+ */
+u8 gameCore_gridAdd(s16 x, s16 y, s16 w, s16 h, u8 layer, u8 id);
+
+/**
+ * @brief Devuelve una entrada registrada.
+ * @param entry Índice devuelto por gameCore_gridAdd o por las consultas.
+ */
+const GameGridEntry* gameCore_gridGetEntry(u8 entry);
+
+/**
+ * @brief Busca las entradas de las capas indicadas que solapan una caja.
+ *
+ * Solo recorre las celdas que cubre la caja y confirma cada candidato con
+ * gameCore_checkCollision. El resultado sale ordenado por orden de registro,
+ * así que la prioridad coincide con la de un recorrido lineal equivalente.
+ *
+ * @param layerMask Capas a considerar.
+ * @param outEntries Índices de entrada encontrados.
+ * @param maxOut Capacidad de outEntries.
+ * @return Número de entradas escritas.
+ */
+u8 gameCore_gridQuery(s16 x, s16 y, s16 w, s16 h, u8 layerMask, u8 *outEntries, u8 maxOut);
+
+
+/* POOL DE ENTIDADES */
+#define GAME_POOL_MAX_SLOTS 16        /* Slots por pool (uno por bit de la máscara). */
+#define GAME_POOL_NONE 0xFF           /* Slot nulo. */
+
+/**
+ * @brief Reparto de slots para entidades guardadas como estructura de arrays.
+ *
+ * El pool solo gestiona qué slots están vivos; los componentes (sprite, x, y...)
+ * viven en arrays paralelos del minijuego indexados por slot. Los vivos se
+ * recorren con gameCore_poolNextSlot sobre una copia de activeMask.
+ */
+typedef struct {
+    u16 activeMask;                   /**< Bit i a 1 si el slot i está vivo. */
+    u8 capacity;                      /**< Slots utilizables (<= GAME_POOL_MAX_SLOTS). */
+    u8 freeCount;                     /**< Slots en la lista libre. */
+    u8 freeList[GAME_POOL_MAX_SLOTS]; /**< Pila de slots libres; se reparte desde el final. */
+} GameEntityPool;
+
+/**
+ * @brief Deja todos los slots libres; gameCore_poolAlloc los devuelve en orden 0, 1, 2...
+ */
+void gameCore_poolInit(GameEntityPool *pool, u8 capacity);
+
+/**
+ * @brief Reserva el siguiente slot libre.
+ * @return Slot reservado o GAME_POOL_NONE si el pool está lleno.
+ */
+u8 gameCore_poolAlloc(GameEntityPool *pool);
+
+/**
+ * @brief Reserva un slot concreto (entidades cuyo slot tiene significado propio).
+ * @return TRUE si el slot estaba libre.
+ */
+u8 gameCore_poolAcquire(GameEntityPool *pool, u8 slot);
+
+/**
+ * @brief Devuelve un slot vivo a la lista libre; no hace nada si ya estaba libre.
+ */
+void gameCore_poolRelease(GameEntityPool *pool, u8 slot);
+
+/**
+ * @brief Indica si un slot está vivo.
+ */
+u8 gameCore_poolIsActive(const GameEntityPool *pool, u8 slot);
+
+/**
+ * @brief Extrae el slot vivo más bajo de una máscara de iteración.
+ *
+ * Uso: `u16 live = pool.activeMask; while (live) { u8 i = gameCore_poolNextSlot(&live); ... }`.
+ * Liberar o reservar slots dentro del bucle no altera la copia que se recorre.
+ *
+ * @param mask Máscara pendiente; se le quita el bit devuelto.
+ * @return Slot extraído o GAME_POOL_NONE si la máscara estaba vacía.
+ */
+u8 gameCore_poolNextSlot(u16 *mask);
+
+/* REPARTO DE IA */
+
+/**
+ * @brief Turnos de decisión en rueda para los agentes de un grupo.
+ *
+ * Cada frame reciben turno perFrame slots consecutivos; solo ellos deciden
+ * (objetivo, cambio de rumbo...). La integración de posición sigue siendo de
+ * cada frame. El coste de decidir queda fijo aunque crezca el grupo: cada
+ * agente decide 1 de cada ceil(count / perFrame) frames.
+ */
+typedef struct {
+    u8 count;    /**< Slots del grupo (<= GAME_POOL_MAX_SLOTS). */
+    u8 perFrame; /**< Slots con turno por frame (1..count). */
+    u8 cursor;   /**< Primer slot del próximo turno. */
+} GameAiSlicer;
+
+/** @brief Prepara la rueda; el primer turno empieza en el slot 0. */
+void gameCore_aiSlicerInit(GameAiSlicer *slicer, u8 count, u8 perFrame);
+
+/**
+ * @brief Avanza la rueda un frame.
+ *
+ * Uso: `u16 turn = gameCore_aiSlicerNext(&slicer) & pool.activeMask;`.
+ *
+ * @return Máscara con los slots que deciden este frame.
+ */
+u16 gameCore_aiSlicerNext(GameAiSlicer *slicer);
+
+/* TRAYECTORIAS RECTAS */
+
+/**
+ * @brief Avance entero en línea recta (Bresenham) para proyectiles.
+ *
+ * Cada paso mueve un píxel por el eje mayor y, cuando toca, otro por el menor;
+ * solo sumas y restas, sin F16_div. La llegada es exacta: con remaining a 0 la
+ * posición es el destino pedido.
+ */
+typedef struct {
+    s16 x;          /**< Posición actual X. */
+    s16 y;          /**< Posición actual Y. */
+    u16 major;      /**< Pasos totales (distancia en el eje mayor). */
+    u16 minor;      /**< Distancia en el eje menor. */
+    u16 remaining;  /**< Pasos que faltan; 0 = en el destino. */
+    s16 err;        /**< Error acumulado del eje menor. */
+    s8 stepX;       /**< Sentido en X (-1, 0, 1). */
+    s8 stepY;       /**< Sentido en Y (-1, 0, 1). */
+    u8 xMajor;      /**< TRUE si el eje mayor es X. */
+    u8 speed;       /**< Pasos por frame de gameCore_lineStep. */
+} GameLineStepper;
+
+/**
+ * @brief Prepara la trayectoria de (x0, y0) a (x1, y1).
+ * @param speed Píxeles por frame en el eje mayor (para gameCore_lineStep).
+ */
+void gameCore_lineInit(GameLineStepper *line, s16 x0, s16 y0, s16 x1, s16 y1, u8 speed);
+
+/**
+ * @brief Avanza un número de pasos (se detiene en el destino).
+ * @return TRUE si ya está en el destino.
+ */
+u8 gameCore_lineAdvance(GameLineStepper *line, u16 steps);
+
+/**
+ * @brief Avanza speed pasos: un frame de vuelo.
+ * @return TRUE si ya está en el destino.
+ */
+u8 gameCore_lineStep(GameLineStepper *line);
+
+/** @brief Desplaza la trayectoria entera (posición y destino), p. ej. con el scroll. */
+void gameCore_lineShift(GameLineStepper *line, s16 offsetX, s16 offsetY);
+
+/* CAPAS DE PROFUNDIDAD */
+#define GAME_DEPTH_MAX_ENTRIES 16     /* Sprites ordenables por lista. */
+
+/**
+ * @brief Sprite dentro de una lista de profundidad.
+ */
+typedef struct {
+    Sprite* sprite;   /**< Sprite ordenado. */
+    s16 key;          /**< Base del sprite (Y inferior); mayor = más delante. */
+    s16 depth;        /**< Última profundidad aplicada con SPR_setDepth. */
+    u8 flags;         /**< Estado interno (enviado este frame, profundidad aplicada). */
+} GameDepthEntry;
+
+/**
+ * @brief Lista persistente de sprites ordenada de delante a detrás.
+ *
+ * Entre frames el orden apenas cambia, así que se recoloca con inserción y
+ * solo se llama a SPR_setDepth en los sprites cuyo puesto ha cambiado. Los
+ * sprites de la lista no deben recibir SPR_setDepth desde otro sitio.
+ */
+typedef struct {
+    GameDepthEntry entries[GAME_DEPTH_MAX_ENTRIES]; /**< Orden actual (índice 0 = delante). */
+    u8 count;                                       /**< Entradas en uso. */
+    s16 baseDepth;                                  /**< Profundidad del primer puesto. */
+    u16 depthCalls;                                 /**< SPR_setDepth del último commit. */
+} GameDepthList;
+
+/**
+ * @brief Vacía la lista; el puesto n recibirá la profundidad baseDepth + n.
+ */
+void gameCore_depthInit(GameDepthList *list, s16 baseDepth);
+
+/**
+ * @brief Abre un frame: los sprites que no se envíen antes del commit salen de la lista.
+ */
+void gameCore_depthBegin(GameDepthList *list);
+
+/**
+ * @brief Envía un sprite visible con su base actual.
+ * @param key Y inferior del sprite en pantalla.
+ */
+void gameCore_depthSubmit(GameDepthList *list, Sprite *sprite, s16 key);
+
+/**
+ * @brief Quita los sprites no enviados, reordena y aplica las profundidades que cambian.
+ * @return Número de llamadas a SPR_setDepth realizadas.
+ */
+u16 gameCore_depthCommit(GameDepthList *list);
+
+/* PLANO EN BUCLE */
+#define GAME_PLANE_COLS 64   /* Ancho del plano en tiles (gameCore_resetVideoState fija 64x64). */
+#define GAME_PLANE_ROWS 64   /* Alto del plano en tiles. */
+
+/**
+ * @brief Fondo vertical en bucle volcado entero al plano.
+ *
+ * Si el bucle mide exactamente lo que el plano (512 px) y cabe a lo ancho, el
+ * mapa se descomprime una vez y se libera: el scroll pasa a ser solo el
+ * registro de scroll vertical, sin motor de mapas ni subida de tiles por frame.
+ * Si no cabe, se conserva el Map y se sigue usando MAP_scrollTo.
+ */
+typedef struct {
+    Map *map;        /**< Solo en el modo de respaldo; NULL si el bucle está en el plano. */
+    VDPPlane plane;  /**< Plano de destino. */
+    s16 offsetY;     /**< Último desfase vertical aplicado. */
+} GameLoopPlane;
+
+/**
+ * @brief Vuelca el bucle al plano y aplica el desfase inicial.
+ * @param loop Estado a preparar.
+ * @param mapDef Mapa del bucle.
+ * @param plane Plano de destino.
+ * @param baseTile Atributos y primer tile (TILE_ATTR_FULL) de su tileset en VRAM.
+ * @param widthPx Ancho del mapa en píxeles.
+ * @param heightPx Alto del mapa (= alto del bucle) en píxeles.
+ * @param offsetY Desfase vertical inicial.
+ */
+void gameCore_loopPlaneInit(GameLoopPlane *loop, const MapDefinition *mapDef, VDPPlane plane,
+    u16 baseTile, u16 widthPx, u16 heightPx, s16 offsetY);
+
+/** @brief Mueve la vista del bucle; no hace nada si el desfase no cambió. */
+void gameCore_loopPlaneScroll(GameLoopPlane *loop, s16 offsetY);
+
+/** @brief Libera el Map del modo de respaldo, si lo hay. */
+void gameCore_loopPlaneRelease(GameLoopPlane *loop);
+
+/* CACHÉ DE ATRIBUTOS DE SPRITE */
+#define GAME_SPRITE_CACHE_SLOTS 64    /* Sprites con estado sombra por fase. */
+
+/**
+ * @brief Llamadas SPR_* que pasaron por la caché desde el último reinicio.
+ */
+typedef struct {
+    u32 forwarded;    /**< Llamadas que llegaron a SGDK (hubo cambio). */
+    u32 skipped;      /**< Llamadas evitadas porque el valor ya estaba aplicado. */
+} GameSpriteCacheStats;
+
+/*
+ * Envoltorios de SPR_setPosition/Visibility/Depth/HFlip/Anim/Frame que solo
+ * llegan a SGDK si el valor cambia. Posición, visibilidad, profundidad y
+ * volteo se comparan con el último valor aplicado (guardado en una tabla
+ * sombra cuyo índice va en sprite->data); animación y frame se comparan con
+ * el propio sprite porque la animación automática los modifica. Un sprite que
+ * use estos envoltorios no debe recibir esos SPR_* directos ni liberarse con
+ * SPR_releaseSprite: usa gameCore_sprRelease.
+ */
+void gameCore_sprSetPosition(Sprite *sprite, s16 x, s16 y);
+void gameCore_sprSetVisibility(Sprite *sprite, SpriteVisibility value);
+void gameCore_sprSetDepth(Sprite *sprite, s16 depth);
+void gameCore_sprSetHFlip(Sprite *sprite, bool value);
+void gameCore_sprSetAnim(Sprite *sprite, s16 anim);
+void gameCore_sprSetFrame(Sprite *sprite, s16 frame);
+
+/**
+ * @brief Libera el sprite y su estado sombra.
+ */
+void gameCore_sprRelease(Sprite *sprite);
+
+/**
+ * @brief Olvida todo el estado sombra (lo llama gameCore_resetVideoState).
+ */
+void gameCore_sprCacheReset(void);
+
+/**
+ * @brief Contadores de llamadas reenviadas/evitadas.
+ */
+const GameSpriteCacheStats* gameCore_getSpriteCacheStats(void);
+
+/**
+ * @brief Pone a cero los contadores sin tocar el estado sombra.
+ */
+void gameCore_resetSpriteCacheStats(void);
+
+/* COLA DE DMA */
+#define GAME_DMA_QUEUE_SLOTS 8         /* Trabajos pendientes a la vez (potencia de 2). */
+#define GAME_DMA_DEFAULT_BUDGET 4096   /* Bytes de tiles por VBlank (128 tiles). */
+#define GAME_DMA_FADE_FRAMES 16        /* Fundido de entrada de un fondo cargado por tramos. */
+
+/** @brief Callback que se ejecuta cuando un trabajo ya está en VRAM. */
+typedef void GameDmaCallback(void);
+
+/**
+ * @brief Subida de tiles troceada entre varios VBlanks.
+ */
+typedef struct {
+    const u32 *data;        /**< Siguiente tile a enviar (sin comprimir). */
+    TileSet *unpacked;      /**< Copia descomprimida a liberar al terminar (o NULL). */
+    u16 index;              /**< Tile destino del siguiente tramo. */
+    u16 remaining;          /**< Tiles pendientes de encolar (0 = solo falta el callback). */
+    GameDmaCallback *done;  /**< Callback de fin (puede ser NULL). */
+} GameDmaJob;
+
+/**
+ * @brief Encola la subida de un tileset a VRAM por tramos.
+ *
+ * Los tilesets comprimidos se descomprimen una vez al encolar. Si la cola
+ * está llena o no hay memoria se carga en el acto por CPU y se llama a done.
+ *
+ * @param tileset Tileset a subir.
+ * @param index Primer tile destino (normalmente de gameCore_vramAlloc).
+ * @param done Callback cuando todos los tiles están en VRAM (puede ser NULL).
+ * @return FALSE si hubo que cargar sin cola.
+ */
+u8 gameCore_dmaQueueTileSet(const TileSet *tileset, u16 index, GameDmaCallback *done);
+
+/**
+ * @brief Encola solo un callback que se ejecuta tras todos los trabajos previos.
+ * @return FALSE si la cola estaba llena (el callback se ejecuta en el acto).
+ */
+u8 gameCore_dmaQueueCallback(GameDmaCallback *done);
+
+/**
+ * @brief Pone la paleta en negro y la funde hacia pal cuando la cola se vacíe.
+ *
+ * Sirve para que una fase cargue su fondo por tramos sin enseñar tiles a medias.
+ *
+ * @param numPal Paleta destino (PAL0..PAL3).
+ * @param pal Colores finales (16).
+ * @param numFrame Duración del fundido en frames.
+ */
+void gameCore_dmaFadeInWhenDone(u16 numPal, const u16 *pal, u16 numFrame);
+
+/** @brief Fija cuántos bytes de tiles se envían como máximo por VBlank. */
+void gameCore_dmaSetBudget(u16 bytesPerFrame);
+
+/**
+ * @brief Cierra los trabajos ya transferidos y encola el siguiente tramo.
+ *
+ * Debe llamarse una vez por frame antes de SYS_doVBlankProcess (el
+ * planificador de fases ya lo hace).
+ */
+void gameCore_dmaProcess(void);
+
+/** @brief TRUE si no queda ningún trabajo ni callback pendiente. */
+u8 gameCore_dmaIsIdle(void);
+
+/** @brief Espera VBlank a VBlank hasta vaciar la cola. */
+void gameCore_dmaFlush(void);
+
+/** @brief Descarta los trabajos pendientes sin llamar a sus callbacks. */
+void gameCore_dmaReset(void);
+
+/* FUNDIDOS */
+#define GAME_FADE_FRAMES 60   /* Duración del fundido entre fases. */
+
+/**
+ * @brief Empieza un fundido a negro de todas las paletas sin bloquear.
+ *
+ * Avanza un paso por frame dentro de gameCore_waitVBlank (y del planificador).
+ *
+ * @param numFrame Duración en frames.
+ * @param fadeMusic TRUE para acompañarlo con XGM2_fadeOut de la misma duración.
+ */
+void gameCore_startFadeOut(u16 numFrame, u8 fadeMusic);
+
+/**
+ * @brief Empieza un fundido de los colores actuales hacia palDst sin bloquear.
+ * @param fromCol Primer color (0..63).
+ * @param toCol Último color incluido.
+ * @param palDst Colores destino (toCol - fromCol + 1).
+ * @param numFrame Duración en frames.
+ */
+void gameCore_startPaletteFade(u16 fromCol, u16 toCol, const u16 *palDst, u16 numFrame);
+
+/** @brief Avanza un paso el fundido en curso (una vez por frame). */
+void gameCore_updateFade(void);
+
+/** @brief TRUE mientras haya un fundido de paletas en curso. */
+u8 gameCore_isFading(void);
+
+/** @brief Espera VBlank a VBlank (procesando la cola de DMA) a que acabe el fundido. */
+void gameCore_waitFade(void);
+
+/**
+ * @brief Avanza fundido y cola de DMA y espera al siguiente VBlank.
+ *
+ * Sustituye a SYS_doVBlankProcess en cualquier bucle propio.
+ */
+void gameCore_waitVBlank(void);
+
+/**
+ * @brief Reserva y empieza a subir un tileset para la fase siguiente.
+ *
+ * La región sobrevive al gameCore_resetVideoState del init de esa fase. Quien
+ * precarga debe vaciar la cola (gameCore_dmaFlush) antes de cambiar de fase.
+ *
+ * @param name Nombre con el que el init recuperará la región.
+ * @param tileset Tileset a subir.
+ * @return Primer tile de la región.
+ */
+u16 gameCore_vramPreload(const char *name, const TileSet *tileset);
+
+/**
+ * @brief Devuelve la región precargada con ese nombre o la reserva y sube ahora.
+ * @param name Nombre de la región.
+ * @param tileset Tileset a subir si no estaba precargado.
+ * @return Primer tile de la región.
+ */
+u16 gameCore_vramBind(const char *name, const TileSet *tileset);
+
+/* TAREAS COOPERATIVAS */
+#define GAME_TASK_MAX 4        /* Tareas vivas a la vez en el planificador. */
+#define GAME_TASK_RUNNING 0    /* La tarea cedió el frame y sigue viva. */
+#define GAME_TASK_DONE 1       /* La tarea terminó. */
+
+typedef struct GameTask GameTask;
+
+/**
+ * @brief Cuerpo de una tarea reanudable.
+ *
+ * Se escribe entre GAME_TASK_BEGIN y GAME_TASK_END. Las variables locales no
+ * sobreviven a un GAME_TASK_YIELD: el estado que cruce frames va en task->data
+ * o en estáticas del módulo. No se puede usar switch dentro del cuerpo.
+ */
+typedef u8 GameTaskFunc(GameTask *task);
+
+/**
+ * @brief Secuencia sin pila que avanza un paso por frame.
+ */
+struct GameTask {
+    GameTaskFunc *run;  /**< Cuerpo de la tarea (NULL = terminada). */
+    u16 line;           /**< Punto de reanudación (línea del último yield). */
+    void *data;         /**< Estado propio de la secuencia. */
+};
+
+/** @brief Abre el cuerpo de una tarea reanudable. */
+#define GAME_TASK_BEGIN(task) switch ((task)->line) { case 0:
+
+/** @brief Cede el resto del frame; la tarea continúa aquí en el siguiente. */
+#define GAME_TASK_YIELD(task) \
+    do { (task)->line = __LINE__; return GAME_TASK_RUNNING; case __LINE__:; } while (0)
+
+/** @brief Cede frames hasta que se cumpla la condición (se evalúa al llegar y al reanudar). */
+#define GAME_TASK_WAIT_UNTIL(task, cond) \
+    do { (task)->line = __LINE__; case __LINE__: if (!(cond)) return GAME_TASK_RUNNING; } while (0)
+
+/** @brief Cierra el cuerpo de una tarea reanudable. */
+#define GAME_TASK_END(task) } (task)->line = 0; return GAME_TASK_DONE
+
+/**
+ * @brief Registra una tarea en el planificador desde su inicio.
+ * @param task Tarea a lanzar (memoria del llamador, debe vivir hasta que acabe).
+ * @param run Cuerpo de la tarea.
+ * @param data Estado propio que recibirá en task->data.
+ * @return FALSE si no hay hueco en el planificador.
+ */
+u8 gameCore_taskStart(GameTask *task, GameTaskFunc *run, void *data);
+
+/** @brief Detiene una tarea; sale del planificador en el siguiente paso. */
+void gameCore_taskStop(GameTask *task);
+
+/** @brief TRUE mientras la tarea no haya terminado. */
+u8 gameCore_taskIsRunning(const GameTask *task);
+
+/** @brief Avanza un paso cada tarea viva en orden de lanzamiento. */
+void gameCore_taskStep(void);
+
+/**
+ * @brief Lanza una tarea y bombea tareas y VBlank hasta que termine.
+ *
+ * El resto de tareas vivas (cargas, audio...) avanzan en los mismos frames.
+ * Si el planificador está lleno, la tarea se ejecuta aquí mismo hasta el
+ * final en lugar de descartarse.
+ */
+void gameCore_taskRun(GameTask *task, GameTaskFunc *run, void *data);
+
+/* PLANIFICADOR DE FRAMES */
+#define GAME_FRAME_STATS_SLOTS 8   /* Ranuras de estadísticas (una por fase del main). */
+#define GAME_FRAME_LINES (SYS_isPAL() ? 313 : 262) /* Líneas por frame del contador V ajustado. */
+#define GAME_VINT_LINE SCREEN_HEIGHT /* Línea en la que salta la VInt y sube vtimer. */
+
+/**
+ * @brief Coste de update medido en líneas de pantalla (contador HV ajustado).
+ */
+typedef struct {
+    u16 frames;        /**< Frames medidos en la fase. */
+    u16 minLines;      /**< Coste mínimo de update en líneas. */
+    u16 maxLines;      /**< Coste máximo de update en líneas. */
+    u32 totalLines;    /**< Suma de costes para calcular la media. */
+    u16 overruns;      /**< Frames en los que update+render no cupo en un VBlank. */
+    u16 vramPeak;      /**< Pico de tiles de usuario reservados durante la fase. */
+    u8 qualityShedPeak; /**< Máximo de efectos opcionales recortados a la vez. */
+} GameFrameStats;
+
+/** @brief Callback de paso de frame de un minijuego (update/render). */
+typedef void GamePhaseStepCallback(void);
+
+/** @brief Callback que indica si el minijuego ha terminado. */
+typedef u8 GamePhaseDoneCallback(void);
+
+/**
+ * @brief Ejecuta el bucle update/render/VBlank de una fase midiendo su coste.
+ *
+ * El render de la fase solo debe preparar sprites; el VBlank lo procesa el
+ * planificador tras medir el coste de update.
+ *
+ * @param statsSlot Ranura de estadísticas (normalmente el id de fase).
+ * @param update Lógica por frame de la fase.
+ * @param render Preparación de sprites/planos del frame.
+ * @param isComplete Condición de salida del bucle.
+ */
+void gameCore_runPhaseLoop(u8 statsSlot, GamePhaseStepCallback *update,
+    GamePhaseStepCallback *render, GamePhaseDoneCallback *isComplete);
+
+/**
+ * @brief Marca de tiempo en líneas que solo crece.
+ *
+ * vtimer sube en la VInt (línea GAME_VINT_LINE) pero el contador V no vuelve
+ * a 0 hasta el final del VBlank: las líneas de VBlank cuentan para el frame
+ * que termina. Restar dos marcas da el coste en líneas aunque la medida
+ * empiece dentro del VBlank o se salga del frame.
+ */
+u32 gameCore_getLineStamp(void);
+
+/**
+ * @brief Devuelve las estadísticas acumuladas de una ranura.
+ * @return Puntero a las estadísticas o NULL si la ranura no existe.
+ */
+const GameFrameStats* gameCore_getFrameStats(u8 statsSlot);
+
+/**
+ * @brief Calcula el coste medio de update de una ranura.
+ * @return Media en líneas (0 si no hay frames medidos).
+ */
+u16 gameCore_getFrameStatsAverage(u8 statsSlot);
+
+/** @brief Coste en líneas del último update medido. */
+u16 gameCore_getLastFrameCost(void);
+
+/* GOBERNADOR DE CALIDAD */
+#define GAME_QUALITY_MAX_EFFECTS 6       /* Efectos opcionales registrables por fase. */
+#define GAME_QUALITY_NONE 0xFF           /* Id devuelto si no quedan huecos (el efecto corre siempre). */
+#define GAME_QUALITY_SHED_LINES 208      /* Coste update+render a partir del cual se recorta. */
+#define GAME_QUALITY_RESTORE_LINES 160   /* Coste por debajo del cual hay holgura. */
+#define GAME_QUALITY_SHED_FRAMES 2       /* Frames caros seguidos antes de recortar un nivel. */
+#define GAME_QUALITY_RESTORE_FRAMES 60   /* Frames con holgura seguidos antes de restaurar uno. */
+
+/**
+ * @brief Registra un efecto opcional de la fase.
+ *
+ * El orden de registro es el orden de recorte: el primero es el primero que
+ * se sacrifica y el último en volver. gameCore_resetVideoState vacía la lista.
+ *
+ * @param name Nombre para trazas.
+ * @param shedInterval Con el efecto recortado corre 1 de cada shedInterval
+ *        frames (0 = no corre nunca).
+ * @return Id del efecto o GAME_QUALITY_NONE.
+ */
+u8 gameCore_qualityRegister(const char *name, u8 shedInterval);
+
+/**
+ * @brief Indica si el efecto debe ejecutarse este frame.
+ * @param effect Id devuelto por gameCore_qualityRegister.
+ * @return TRUE si está activo o si le toca su frame reducido.
+ */
+u8 gameCore_qualityShouldRun(u8 effect);
+
+/**
+ * @brief Alimenta al gobernador con el coste del frame cerrado.
+ *
+ * Un VBlank perdido recorta un nivel al momento; un coste alto sostenido
+ * también. La holgura sostenida restaura de uno en uno. Un coste de un frame
+ * o más sin VBlank perdido es una lectura imposible y se ignora.
+ *
+ * @param lines Coste update+render en líneas.
+ * @param overrun TRUE si el frame no cupo en un VBlank.
+ */
+void gameCore_qualityFeed(u16 lines, u8 overrun);
+
+/** @brief Número de efectos recortados ahora mismo. */
+u8 gameCore_qualityGetShedCount(void);
+
+/** @brief Olvida los efectos registrados y vuelve a calidad completa. */
+void gameCore_qualityReset(void);
+
+/* INSTRUMENTACIÓN */
+
+/**
+ * @brief Funciones calientes contadas por frame.
+ */
+typedef enum {
+    GAME_PROF_SPR_SET_POSITION = 0, /**< SPR_setPosition que llegan a SGDK. */
+    GAME_PROF_CHECK_COLLISION = 1,  /**< gameCore_checkCollision. */
+    GAME_PROF_PLAY_PCM = 2,         /**< XGM2_playPCM. */
+    GAME_PROF_MAP_SCROLL = 3,       /**< MAP_scrollTo. */
+    GAME_PROF_COUNTERS = 4          /**< Número de contadores. */
+} GameProfCounter;
+
+#if GAME_PROFILE
+#define GAME_PROF_DUMP_FRAMES 300    /* Frames entre volcados por KDebug (5 s). */
+#define GAME_PROF_OVERLAY_FRAMES 8   /* Frames entre refrescos del overlay. */
+#define GAME_PROF_OVERLAY_ROWS 2     /* Filas superiores del plano WINDOW que ocupa el overlay. */
+#define GAME_PROF_OVERLAY_COMBO (BUTTON_START | BUTTON_A | BUTTON_C) /* Muestra/oculta el overlay. */
+
+/**
+ * @brief Último frame cerrado y picos desde el último volcado.
+ */
+typedef struct {
+    u16 last[GAME_PROF_COUNTERS];  /**< Llamadas en el último frame. */
+    u16 peak[GAME_PROF_COUNTERS];  /**< Máximo por frame desde el último volcado. */
+    u16 sprites;                   /**< Sprites activos al cerrar el frame. */
+    u16 spritesPeak;               /**< Máximo de sprites activos. */
+    u16 lines;                     /**< Líneas usadas (contador HV) al cerrar el frame. */
+    u16 linesPeak;                 /**< Máximo de líneas usadas. */
+} GameProfSnapshot;
+
+/** @brief Suma una llamada al contador del frame en curso. */
+void gameCore_profCount(GameProfCounter counter);
+
+/**
+ * @brief Abre el frame: guarda la marca de línea desde la que se mide.
+ *
+ * Lo llama gameCore_waitVBlank justo al volver del VBlank.
+ */
+void gameCore_profBeginFrame(void);
+
+/**
+ * @brief Cierra el frame: guarda contadores, sprites y líneas, atiende el
+ * combo del overlay y vuelca por KDebug cada GAME_PROF_DUMP_FRAMES.
+ *
+ * Las líneas son las transcurridas desde gameCore_profBeginFrame (incluido
+ * el VBlank). Lo llama gameCore_waitVBlank justo antes del VBlank.
+ */
+void gameCore_profEndFrame(void);
+
+/** @brief Muestra u oculta el overlay fijo del plano WINDOW. */
+void gameCore_profSetOverlay(u8 enabled);
+
+/** @brief Datos del último frame cerrado. */
+const GameProfSnapshot* gameCore_profGetSnapshot(void);
+
+#define GAME_PROF_COUNT(counter) gameCore_profCount(counter)
+#define GAME_PROF_BEGIN_FRAME() gameCore_profBeginFrame()
+#define GAME_PROF_END_FRAME() gameCore_profEndFrame()
+#define GAME_PROF_LOG(...) kprintf(__VA_ARGS__) /* Trazas de diagnóstico; en release no se compilan. */
+
+/* Las funciones SGDK calientes se cuentan en todos los módulos que incluyen
+   este fichero sin tocar sus llamadas (un macro no se expande a sí mismo). */
+#define SPR_setPosition(...) (gameCore_profCount(GAME_PROF_SPR_SET_POSITION), SPR_setPosition(__VA_ARGS__))
+#define XGM2_playPCM(...) (gameCore_profCount(GAME_PROF_PLAY_PCM), XGM2_playPCM(__VA_ARGS__))
+#define MAP_scrollTo(...) (gameCore_profCount(GAME_PROF_MAP_SCROLL), MAP_scrollTo(__VA_ARGS__))
+#else
+#define GAME_PROF_COUNT(counter) ((void)0)
+#define GAME_PROF_BEGIN_FRAME() ((void)0)
+#define GAME_PROF_END_FRAME() ((void)0)
+#define GAME_PROF_LOG(...) ((void)0)
+#endif
+
 #endif
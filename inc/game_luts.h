@@ -0,0 +1,37 @@
+/* Generado por tools/gen_luts.py: no editar a mano. */
+#ifndef _GAME_LUTS_H_
+#define _GAME_LUTS_H_
+
+#include <genesis.h>
+
+/**
+ * @file game_luts.h
+ * @brief Tablas precalculadas para la matemática fix16 de los bucles calientes.
+ *
+ * Sustituyen divisiones (DIVS) y cadenas de F16_mul por una consulta y, como
+ * mucho, una multiplicación. Para cambiarlas edita tools/gen_luts.py.
+ */
+
+#define GAME_LUT_RECIP_SIZE 256   /* Divisores admitidos por GAME_LUT_RATIO_FIX16: 1..255. */
+#define GAME_LUT_RECIP_SHIFT 15  /* Escala de gameLut_recip (2^15). */
+#define GAME_LUT_ARC_STEPS 65     /* Entradas de gameLut_arc (progreso fix16 de 0 a FIX16(1)). */
+#define GAME_LUT_SWAY_STEPS 256   /* Entradas de gameLut_sway (una vuelta). */
+
+/** @brief ceil(2^GAME_LUT_RECIP_SHIFT / n); la entrada 0 no se usa. */
+extern const u16 gameLut_recip[GAME_LUT_RECIP_SIZE];
+
+/** @brief 4t(1-t) en fix16 indexado por el progreso t en fix16 (0..FIX16(1)). */
+extern const u8 gameLut_arc[GAME_LUT_ARC_STEPS];
+
+/** @brief 64*sin(2*pi*i/GAME_LUT_SWAY_STEPS) en píxeles. */
+extern const s8 gameLut_sway[GAME_LUT_SWAY_STEPS];
+
+/**
+ * @brief d/n en fix16 sin dividir (n entre 1 y GAME_LUT_RECIP_SIZE - 1).
+ *
+ * Exacto cuando d es múltiplo de n y nunca por debajo del cociente real.
+ */
+#define GAME_LUT_RATIO_FIX16(d, n) \
+    ((fix16)(((s32)(d) * (s32)gameLut_recip[(n)]) >> (GAME_LUT_RECIP_SHIFT - FIX16_FRAC_BITS)))
+
+#endif
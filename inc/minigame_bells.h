@@ -8,6 +8,13 @@
  * @brief Interfaces públicas para la fase 3: Campanadas.
  */
 
+/**
+ * @brief Precarga en VRAM el fondo y la nieve de la fase mientras corre la cutscene.
+ *
+ * El init recupera las regiones precargadas; si no se llamó, las carga él.
+ */
+void minigameBells_preload(void);
+
 /** @brief Inicializa recursos y estado de la fase de campanas. */
 void minigameBells_init(void);
 
@@ -26,4 +33,11 @@ u8 minigameBells_isComplete(void);
 /** @brief Libera recursos persistentes de la fase de campanas. */
 void minigameBells_shutdown(void);
 
+/**
+ * @brief Rellena los huecos libres hasta la carga máxima de la fase.
+ *
+ * Solo para el banco de estrés: se llama antes de cada update.
+ */
+void minigameBells_forceStress(void);
+
 #endif
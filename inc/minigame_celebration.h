@@ -22,7 +22,7 @@ void minigameCelebration_init(void);
 /** @brief Avanza la animacion y contadores de celebracion. */
 void minigameCelebration_update(void);
 
-/** @brief Renderiza sprites y procesa VBlank en la fase final. */
+/** @brief Prepara el frame de la fase final (el VBlank lo gestiona el núcleo). */
 void minigameCelebration_render(void);
 
 /**
@@ -13,13 +13,20 @@
  * parpadeo al subir o bajar.
  */
 
+/**
+ * @brief Precarga en VRAM los tejados y la nieve de la fase mientras corre la cutscene.
+ *
+ * El init recupera las regiones precargadas; si no se llamó, las carga él.
+ */
+void minigameDelivery_preload(void);
+
 /** @brief Inicializa estado y recursos del minijuego de entrega. */
 void minigameDelivery_init(void);
 
 /** @brief Procesa la lógica y progresión automática de entregas. */
 void minigameDelivery_update(void);
 
-/** @brief Dibuja sprites y sincroniza VBlank para la fase de entrega. */
+/** @brief Dibuja sprites de la fase de entrega (el VBlank lo gestiona el núcleo). */
 void minigameDelivery_render(void);
 
 /**
@@ -31,4 +38,11 @@ u8 minigameDelivery_isComplete(void);
 /** @brief Libera mapas y estructuras persistentes de la fase. */
 void minigameDelivery_shutdown(void);
 
+/**
+ * @brief Rellena los huecos libres hasta la carga máxima de la fase.
+ *
+ * Solo para el banco de estrés: se llama antes de cada update.
+ */
+void minigameDelivery_forceStress(void);
+
 #endif
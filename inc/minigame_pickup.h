@@ -8,6 +8,13 @@
  * @brief Interfaces públicas para la fase 1: Recogida de regalos.
  */
 
+/**
+ * @brief Precarga en VRAM la pista y la nieve de la fase mientras corre la cutscene.
+ *
+ * El init recupera las regiones precargadas; si no se llamó, las carga él.
+ */
+void minigamePickup_preload(void);
+
 /** @brief Inicializa recursos, sprites y estado de la fase de recogida. */
 void minigamePickup_init(void);
 
@@ -26,4 +33,11 @@ u8 minigamePickup_isComplete(void);
 /** @brief Libera recursos persistentes (mapas) de la fase de recogida. */
 void minigamePickup_shutdown(void);
 
+/**
+ * @brief Rellena los huecos libres hasta la carga máxima de la fase.
+ *
+ * Solo para el banco de estrés: se llama antes de cada update.
+ */
+void minigamePickup_forceStress(void);
+
 #endif
@@ -9,11 +9,32 @@
  * @brief Efecto de nieve en primer plano reutilizable por cualquier minijuego.
  */
 
+#define SNOW_SWAY_PX 64      /* Amplitud máxima del vaivén horizontal (sinFix16 va de -64 a 64). */
+#define SNOW_MAX_LAYERS 4    /* Bandas de profundidad en SNOW_MODE_LAYERED. */
+#define SNOW_SCREEN_ROWS 28  /* Filas de tiles en pantalla (224 px). */
+
+/** @brief Forma de mover la nieve en BG_A. */
+typedef enum {
+    SNOW_MODE_MAP = 0,        /**< MAP_scrollTo cada frame (sirve para cualquier arte). */
+    SNOW_MODE_PLANE_WRAP = 1, /**< Plano cargado una vez y movido solo con registros de scroll. */
+    SNOW_MODE_LAYERED = 2     /**< Como PLANE_WRAP, con un vaivén propio por banda de filas. */
+} SnowMode;
+
+/**
+ * @brief Banda horizontal de nieve con su propio vaivén (de arriba abajo).
+ */
+typedef struct {
+    u8 rows;          /**< Filas de tiles de pantalla que ocupa la banda. */
+    s16 angleStep;    /**< Velocidad del vaivén (misma escala que snowEffect_init). */
+    u8 amplitude;     /**< Amplitud en píxeles (como máximo SNOW_SWAY_PX). */
+} SnowLayer;
+
 /**
  * @brief Estado interno del efecto de nieve animada.
  */
 typedef struct {
-    Map *map;         /**< Mapa de tiles usado para el scroll. */
+    Map *map;         /**< Mapa de tiles usado para el scroll (NULL en SNOW_MODE_PLANE_WRAP). */
+    SnowMode mode;    /**< Modo de scroll realmente en uso. */
     s32 offsetX;      /**< Desfase horizontal aplicado al mapa. */
     s32 offsetY;      /**< Desfase vertical aplicado al mapa. */
     s16 angle;        /**< Ángulo para el movimiento sinusoidal. */
@@ -21,16 +42,59 @@ typedef struct {
     s16 verticalStep; /**< Incremento de desplazamiento vertical por frame. */
     u16 widthPx;      /**< Ancho en píxeles del mapa de nieve. */
     u16 heightPx;     /**< Alto en píxeles del mapa de nieve. */
+    const SnowLayer *layers;          /**< Bandas de SNOW_MODE_LAYERED (NULL en otros modos). */
+    u8 numLayers;                     /**< Bandas usadas. */
+    u16 layerAngle[SNOW_MAX_LAYERS];  /**< Fase del vaivén de cada banda. */
+    s16 rowScroll[SNOW_SCREEN_ROWS];  /**< Tabla HSCROLL por fila enviada por DMA cada frame. */
 } SnowEffect;
 
 /**
  * @brief Inicializa recursos y parámetros del efecto de nieve.
  * @param effect Estructura a rellenar.
- * @param tileIndex Índice global de tiles; se actualiza tras cargar el tileset.
+ *
+ * Los tiles de nieve viven en una región residente de VRAM, así que solo se
+ * cargan la primera vez que una fase usa el efecto.
+ *
  * @param angleStep Incremento de ángulo horizontal por frame.
  * @param verticalStep Incremento vertical aplicado cada frame.
  */
-void snowEffect_init(SnowEffect *effect, u32 *tileIndex, s16 angleStep, s16 verticalStep);
+void snowEffect_init(SnowEffect *effect, s16 angleStep, s16 verticalStep);
+
+/**
+ * @brief Igual que snowEffect_init pero eligiendo el modo de scroll.
+ *
+ * SNOW_MODE_PLANE_WRAP vuelca el patrón entero en el plano de 64x64 tiles una
+ * sola vez y luego solo escribe VSCROLL/HSCROLL. Necesita un patrón que se
+ * repita sin costuras y tan alto como el plano; si no lo es, se usa el mapa.
+ *
+ * @param effect Estructura a rellenar.
+ * @param angleStep Incremento de ángulo horizontal por frame.
+ * @param verticalStep Incremento vertical aplicado cada frame.
+ * @param mode Modo pedido.
+ */
+void snowEffect_initMode(SnowEffect *effect, s16 angleStep, s16 verticalStep, SnowMode mode);
+
+/**
+ * @brief Inicializa la nieve con bandas de paralaje por filas de tiles.
+ *
+ * Pasa el scroll horizontal a modo por tile (HSCROLL_TILE) y cada frame manda
+ * una única tabla de SNOW_SCREEN_ROWS valores por DMA. La última banda se
+ * extiende hasta el final de la pantalla. Si el patrón no permite envolver el
+ * plano se queda en SNOW_MODE_MAP y las bandas se ignoran.
+ *
+ * @param effect Estructura a rellenar.
+ * @param layers Bandas de arriba abajo (deben vivir mientras dure la fase).
+ * @param numLayers Número de bandas (1..SNOW_MAX_LAYERS).
+ * @param verticalStep Incremento vertical común aplicado cada frame.
+ */
+void snowEffect_initLayers(SnowEffect *effect, const SnowLayer *layers, u8 numLayers, s16 verticalStep);
+
+/**
+ * @brief Encola los tiles de nieve si aún no están en VRAM.
+ *
+ * Pensado para las precargas de fase; snowEffect_init ya no tendrá que subirlos.
+ */
+void snowEffect_preload(void);
 
 /**
  * @brief Actualiza desplazamientos y scroll del mapa de nieve.
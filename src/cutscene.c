@@ -16,11 +16,24 @@
 #define CUTSCENE_MAX_LINE_LENGTH 24 /* Ancho máximo de cada línea en caracteres. */
 #define CUTSCENE_LETTER_DELAY_FRAMES 4 /* Pausa entre letras para efecto tecleo. */
 
-static void cutscene_play(const char* const* lines, u8 lineCount);
-static u8 drawTextProgressive(const char* text, u16 x, u16 y);
-static u8 waitFramesOrSkip(u16 frames);
+/**
+ * @brief Estado de la escena que sobrevive entre frames de la tarea.
+ */
+typedef struct {
+    const char* const* lines;  /**< Textos a escribir. */
+    u8 lineCount;              /**< Número de líneas. */
+    u8 line;                   /**< Línea en curso. */
+    u8 len;                    /**< Letras ya escritas de la línea. */
+    u8 delay;                  /**< Frames esperados tras la última letra. */
+    u8 skipped;                /**< TRUE si se saltó la línea en curso. */
+    u8 promptVisible;          /**< Estado del parpadeo del aviso final. */
+    u16 blinkCounter;          /**< Frames desde el último cambio de parpadeo. */
+    char buffer[CUTSCENE_MAX_LINE_LENGTH + 1]; /**< Texto parcial de la línea. */
+} CutsceneState;
+
+static void cutscene_play(const char* const* lines, u8 lineCount, CutscenePreloadCallback *preload);
+static u8 cutsceneTask(GameTask *task);
 static u8 isSkipButtonPressed(void);
-static void waitSkipRelease(void);
 
 // SPANISH CHARSET
 // ñ --> ^
@@ -33,7 +46,7 @@ static void waitSkipRelease(void);
 // > --> ¡
 // {} --> Flechas para remarcar
 
-void cutscene_phase1_intro(void) {
+void cutscene_phase1_intro(CutscenePreloadCallback *preload) {
     static const char* const linesEs[CUTSCENE_MAX_LINES] = {
         "Los esbirros del Grinch",
         "robaron los 10 regalos",
@@ -53,10 +66,10 @@ void cutscene_phase1_intro(void) {
         "back before delivery"
     };
     const char* const* lines = (g_selectedLanguage == GAME_LANG_SPANISH) ? linesEs : linesEn;
-    cutscene_play(lines, 7);
+    cutscene_play(lines, 7, preload);
 }
 
-void cutscene_phase2_intro(void) {
+void cutscene_phase2_intro(CutscenePreloadCallback *preload) {
     static const char* const linesEs[CUTSCENE_MAX_LINES] = {
         "Por fin puedo repartir",
         "los regalos que faltaban",
@@ -76,10 +89,10 @@ void cutscene_phase2_intro(void) {
         "into the right houses"
     };
     const char* const* lines = (g_selectedLanguage == GAME_LANG_SPANISH) ? linesEs : linesEn;
-    cutscene_play(lines, 7);
+    cutscene_play(lines, 7, preload);
 }
 
-void cutscene_phase3_intro(void) {
+void cutscene_phase3_intro(CutscenePreloadCallback *preload) {
     static const char* const linesEs[CUTSCENE_MAX_LINES] = {
         "Gracias por salvar",
         "la Navidad conmigo",
@@ -97,10 +110,10 @@ void cutscene_phase3_intro(void) {
         "shape the greeting"
     };
     const char* const* lines = (g_selectedLanguage == GAME_LANG_SPANISH) ? linesEs : linesEn;
-    cutscene_play(lines, 6);
+    cutscene_play(lines, 6, preload);
 }
 
-static void cutscene_play(const char* const* lines, u8 lineCount) {
+static void cutscene_play(const char* const* lines, u8 lineCount, CutscenePreloadCallback *preload) {
     if (lines == NULL || lineCount == 0) return;
 
     /* Asegura estado limpio de video, sprites y audio antes de mostrar. */
@@ -116,84 +129,91 @@ static void cutscene_play(const char* const* lines, u8 lineCount) {
         PAL_setPalette(PAL_COMMON, image_fondo_cutscene.palette->data, CPU);
     }
 
+    const u16 fondoTiles = gameCore_vramAlloc("fondo_cutscene", image_fondo_cutscene.tileset->numTile);
     VDP_drawImageEx(BG_B, &image_fondo_cutscene,
-        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, globalTileIndex),
+        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, fondoTiles),
         0, 0, FALSE, TRUE);
-    globalTileIndex += image_fondo_cutscene.tileset->numTile;
 
-    for (u8 i = 0; i < lineCount; i++) {
-        u8 skipped = drawTextProgressive(lines[i], CUTSCENE_TEXT_START_X, CUTSCENE_TEXT_START_Y + i);
-        if (skipped) {
-            waitSkipRelease();
-        }
+    /* La fase siguiente sube sus tiles mientras se escribe el texto. */
+    if (preload != NULL) {
+        preload();
     }
 
-    const char* prompt = (g_selectedLanguage == GAME_LANG_SPANISH) ?
-        "} PULSA UN BOTON {" :
-        "} PRESS ANY BUTTON {";
-    u16 promptX = CUTSCENE_TEXT_START_X;
-    u16 promptY = CUTSCENE_TEXT_START_Y + lineCount + 2;
-    u8 promptVisible = TRUE;
-    u16 blinkCounter = 0;
-
-    u16 input = 0;
-    while ((input & (BUTTON_START | BUTTON_A | BUTTON_B | BUTTON_C)) == 0) {
-        input = JOY_readJoypad(JOY_1);
-        if (promptVisible) {
-            VDP_drawText(prompt, promptX, promptY);
-        } else {
-            VDP_clearText(promptX, promptY, strlen(prompt));
-        }
-        blinkCounter++;
-        if (blinkCounter >= 30) {
-            blinkCounter = 0;
-            promptVisible = !promptVisible;
-        }
-        SYS_doVBlankProcess();
-    }
-}
+    static CutsceneState state;
+    static GameTask task;
+    memset(&state, 0, sizeof(state));
+    state.lines = lines;
+    state.lineCount = lineCount;
+    gameCore_taskRun(&task, cutsceneTask, &state);
 
-static u8 drawTextProgressive(const char* text, u16 x, u16 y) {
-    if (text == NULL) return FALSE;
-    char buffer[CUTSCENE_MAX_LINE_LENGTH + 1];
-    u8 len = 0;
+    /* Si se saltó el texto, termina aquí lo que quede de la precarga. */
+    gameCore_dmaFlush();
+}
 
-    while (text[len] != '\0' && len < CUTSCENE_MAX_LINE_LENGTH) {
-        if (isSkipButtonPressed()) {
-            VDP_drawText(text, x, y);
-            return TRUE;
+/**
+ * @brief Texto letra a letra y aviso parpadeante como tarea reanudable.
+ *
+ * Un botón escribe la línea entera y espera a que se suelte; al final el aviso
+ * parpadea hasta que se pulse un botón.
+ */
+static u8 cutsceneTask(GameTask *task) {
+    CutsceneState *state = (CutsceneState*)task->data;
+
+    GAME_TASK_BEGIN(task);
+    for (state->line = 0; state->line < state->lineCount; state->line++) {
+        state->len = 0;
+        state->skipped = FALSE;
+        while (state->lines[state->line][state->len] != '\0' && state->len < CUTSCENE_MAX_LINE_LENGTH) {
+            if (isSkipButtonPressed()) {
+                state->skipped = TRUE;
+                break;
+            }
+
+            state->buffer[state->len] = state->lines[state->line][state->len];
+            state->buffer[state->len + 1] = '\0';
+            VDP_drawText(state->buffer, CUTSCENE_TEXT_START_X, CUTSCENE_TEXT_START_Y + state->line);
+            for (state->delay = 0; state->delay < CUTSCENE_LETTER_DELAY_FRAMES; state->delay++) {
+                GAME_TASK_YIELD(task);
+                if (isSkipButtonPressed()) {
+                    state->skipped = TRUE;
+                    break;
+                }
+            }
+            if (state->skipped) break;
+            state->len++;
         }
 
-        buffer[len] = text[len];
-        buffer[len + 1] = '\0';
-        VDP_drawText(buffer, x, y);
-        if (waitFramesOrSkip(CUTSCENE_LETTER_DELAY_FRAMES)) {
-            VDP_drawText(text, x, y);
-            return TRUE;
+        if (state->skipped) {
+            VDP_drawText(state->lines[state->line], CUTSCENE_TEXT_START_X, CUTSCENE_TEXT_START_Y + state->line);
+            GAME_TASK_WAIT_UNTIL(task, !isSkipButtonPressed());
         }
-        len++;
     }
 
-    return FALSE;
-}
+    state->promptVisible = TRUE;
+    state->blinkCounter = 0;
+    while (TRUE) {
+        const char* prompt = (g_selectedLanguage == GAME_LANG_SPANISH) ?
+            "} PULSA UN BOTON {" :
+            "} PRESS ANY BUTTON {";
+        const u16 promptY = CUTSCENE_TEXT_START_Y + state->lineCount + 2;
+        if (state->promptVisible) {
+            VDP_drawText(prompt, CUTSCENE_TEXT_START_X, promptY);
+        } else {
+            VDP_clearText(CUTSCENE_TEXT_START_X, promptY, strlen(prompt));
+        }
+        if (isSkipButtonPressed()) break;
 
-static u8 waitFramesOrSkip(u16 frames) {
-    for (u16 i = 0; i < frames; i++) {
-        SYS_doVBlankProcess();
-        if (isSkipButtonPressed()) {
-            return TRUE;
+        state->blinkCounter++;
+        if (state->blinkCounter >= 30) {
+            state->blinkCounter = 0;
+            state->promptVisible = !state->promptVisible;
         }
+        GAME_TASK_YIELD(task);
     }
-    return FALSE;
+    GAME_TASK_END(task);
 }
 
 static u8 isSkipButtonPressed(void) {
-    const u16 input = JOY_readJoypad(JOY_1);
+    const u16 input = gameCore_readInput();
     return (input & (BUTTON_START | BUTTON_A | BUTTON_B | BUTTON_C)) ? TRUE : FALSE;
 }
-
-static void waitSkipRelease(void) {
-    while (isSkipButtonPressed()) {
-        SYS_doVBlankProcess();
-    }
-}
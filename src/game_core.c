@@ -5,12 +5,227 @@
 
 #include "game_core.h"
 
-u32 globalTileIndex = TILE_USER_INDEX; /**< Índice global base de tiles libres. */
 GameLanguage g_selectedLanguage = GAME_LANG_ENGLISH; /**< Idioma actual del juego. */
+static GameFrameStats frameStats[GAME_FRAME_STATS_SLOTS]; /**< Coste de update por fase. */
+static u16 lastFrameCost = 0; /**< Coste en líneas del último update medido. */
 
-/** @brief Lee entrada del mando 1. */
+static GameVramRegion vramRegions[GAME_VRAM_MAX_REGIONS]; /**< Regiones vivas ordenadas por base. */
+static u8 vramRegionCount = 0;  /**< Regiones vivas en vramRegions. */
+static u16 vramUsed = 0;        /**< Tiles reservados ahora mismo. */
+static u16 vramHighWater = 0;   /**< Pico de vramUsed desde el último inicio de fase. */
+
+static GameDmaJob dmaJobs[GAME_DMA_QUEUE_SLOTS]; /**< Cola circular de subidas de tiles. */
+static u8 dmaHead = 0;          /**< Trabajo más antiguo. */
+static u8 dmaCount = 0;         /**< Trabajos en cola. */
+static u16 dmaBudgetTiles = GAME_DMA_DEFAULT_BUDGET / TILE_SIZE; /**< Tiles por VBlank. */
+static u16 dmaFadePal;          /**< Paleta del fundido pendiente. */
+static const u16 *dmaFadeColors; /**< Colores finales del fundido pendiente. */
+static u16 dmaFadeFrames;       /**< Duración del fundido pendiente. */
+static const u16 blackColors[64] = { 0 }; /**< Paletas en negro (origen o destino de fundidos). */
+static u16 fadeColors[64];      /**< Colores de partida del fundido en curso. */
+static u8 fadeActive = FALSE;   /**< Hay un fundido avanzando con PAL_doFadeStep. */
+
+static GameTask *tasks[GAME_TASK_MAX]; /**< Tareas vivas en orden de lanzamiento. */
+static u8 taskCount = 0;        /**< Tareas en tasks. */
+
+static u16 rngSeeds[GAME_RNG_STREAMS];  /**< Semilla derivada de cada flujo. */
+static u16 rngStates[GAME_RNG_STREAMS]; /**< Estado xorshift de cada flujo. */
+
+/** @brief Deriva semillas distintas y no nulas para cada flujo. */
+void gameCore_seedRandom(u16 seed) {
+    if (seed == 0) seed = 0xACE1;
+    for (u16 i = 0; i < GAME_RNG_STREAMS; i++) {
+        u16 derived = seed ^ (u16)(0x9E37 * (i + 1));
+        rngSeeds[i] = derived ? derived : 0xACE1;
+        rngStates[i] = rngSeeds[i];
+    }
+}
+
+/** @brief Reinicia un flujo a su semilla derivada. */
+void gameCore_resetRandomStream(GameRngStream stream) {
+    if (stream >= GAME_RNG_STREAMS) return;
+    if (rngSeeds[stream] == 0) gameCore_seedRandom(0);
+    rngStates[stream] = rngSeeds[stream];
+}
+
+/** @brief xorshift de 16 bits (7, 9, 8): periodo 65535, solo desplazamientos y XOR. */
+u16 gameCore_random(GameRngStream stream) {
+    if (stream >= GAME_RNG_STREAMS) return 0;
+    u16 x = rngStates[stream];
+    if (x == 0) x = 0xACE1;
+    x ^= x << 7;
+    x ^= x >> 9;
+    x ^= x << 8;
+    rngStates[stream] = x;
+    return x;
+}
+
+/** @brief Rango acotado [0, range) con multiplicación 16x16 y desplazamiento. */
+u16 gameCore_randomRange(GameRngStream stream, u16 range) {
+    return (u16)(((u32)gameCore_random(stream) * range) >> 16);
+}
+
+#define INPUT_SRAM_MAGIC 0x5344 /* Cabecera de grabación válida en SRAM (v2: con palabra de flags). */
+#define INPUT_FLAG_TRUNCATED 0x0001 /* La grabación se cortó antes del final de la partida. */
+
+static GameInputRun inputRuns[GAME_INPUT_MAX_RUNS]; /**< Grabación RLE de la entrada. */
+static u16 inputRunCount = 0;      /**< Tramos usados en inputRuns. */
+static u16 inputRunCursor = 0;     /**< Tramo actual durante la reproducción. */
+static u16 inputRunConsumed = 0;   /**< Frames ya reproducidos del tramo actual. */
+static u16 inputSeed = 0;          /**< Semilla asociada a la grabación. */
+static u8 inputTruncated = FALSE;  /**< Grabación cortada o reproducción agotada antes de tiempo. */
+static GameInputMode inputMode = GAME_INPUT_LIVE; /**< Origen actual de la entrada. */
+static u16 latchedInput = 0;       /**< Máscara muestreada en el frame actual. */
+static u32 latchedFrame = 0xFFFFFFFF; /**< vtimer del último muestreo. */
+
+/**
+ * @brief Añade un frame a la grabación alargando el último tramo si coincide.
+ * @param buttons Máscara del frame.
+ */
+static void recordInputFrame(u16 buttons) {
+    if (inputRunCount > 0) {
+        GameInputRun *last = &inputRuns[inputRunCount - 1];
+        if (last->buttons == buttons && last->frames < 0xFFFF) {
+            last->frames++;
+            return;
+        }
+    }
+    if (inputRunCount >= GAME_INPUT_MAX_RUNS) {
+        /* Sin sitio: se deja de grabar y la grabación queda marcada como incompleta. */
+        inputTruncated = TRUE;
+        inputMode = GAME_INPUT_LIVE;
+        return;
+    }
+    inputRuns[inputRunCount].buttons = buttons;
+    inputRuns[inputRunCount].frames = 1;
+    inputRunCount++;
+}
+
+/**
+ * @brief Devuelve el siguiente frame de la grabación.
+ *
+ * Si la grabación se agota sigue en modo reproducción sin botones y la marca
+ * como truncada: mezclar el mando en directo rompería la repetibilidad.
+ *
+ * @return Máscara reproducida o 0 al terminar.
+ */
+static u16 replayInputFrame(void) {
+    while (inputRunCursor < inputRunCount) {
+        const GameInputRun *run = &inputRuns[inputRunCursor];
+        if (inputRunConsumed < run->frames) {
+            inputRunConsumed++;
+            return run->buttons;
+        }
+        inputRunCursor++;
+        inputRunConsumed = 0;
+    }
+    inputTruncated = TRUE;
+    return 0;
+}
+
+/** @brief Lee entrada del mando 1 (o de la grabación) una vez por frame. */
 u16 gameCore_readInput(void) {
-    return JOY_readJoypad(JOY_1);
+    if (latchedFrame == vtimer) return latchedInput;
+    latchedFrame = vtimer;
+
+    if (inputMode == GAME_INPUT_REPLAY) {
+        latchedInput = replayInputFrame();
+    } else {
+        latchedInput = JOY_readJoypad(JOY_1);
+        if (inputMode == GAME_INPUT_RECORD) {
+            recordInputFrame(latchedInput);
+        }
+    }
+    return latchedInput;
+}
+
+/** @brief Empieza una grabación nueva con la semilla indicada. */
+void gameCore_startInputRecording(u16 seed) {
+    inputRunCount = 0;
+    inputTruncated = FALSE;
+    inputSeed = seed;
+    gameCore_seedRandom(seed);
+    latchedFrame = 0xFFFFFFFF;
+    inputMode = GAME_INPUT_RECORD;
+}
+
+/** @brief Reproduce la grabación en memoria desde el principio. */
+u8 gameCore_startInputReplay(void) {
+    if (inputRunCount == 0) return FALSE;
+    inputRunCursor = 0;
+    inputRunConsumed = 0;
+    inputTruncated = FALSE;
+    gameCore_seedRandom(inputSeed);
+    latchedFrame = 0xFFFFFFFF;
+    inputMode = GAME_INPUT_REPLAY;
+    return TRUE;
+}
+
+/** @brief Vuelve al mando en directo conservando la grabación. */
+void gameCore_stopInputCapture(void) {
+    inputMode = GAME_INPUT_LIVE;
+}
+
+GameInputMode gameCore_getInputMode(void) {
+    return inputMode;
+}
+
+u16 gameCore_getInputRunCount(void) {
+    return inputRunCount;
+}
+
+u8 gameCore_isInputTruncated(void) {
+    return inputTruncated;
+}
+
+/**
+ * @brief Guarda cabecera (magic, semilla, tramos) y tramos en SRAM.
+ * @return FALSE si la grabación está vacía.
+ */
+u8 gameCore_saveInputRecording(void) {
+    if (inputRunCount == 0) return FALSE;
+
+    u32 offset = GAME_INPUT_SRAM_OFFSET;
+    SRAM_enable();
+    SRAM_writeWord(offset, INPUT_SRAM_MAGIC);
+    SRAM_writeWord(offset + 2, inputSeed);
+    SRAM_writeWord(offset + 4, inputRunCount);
+    SRAM_writeWord(offset + 6, inputTruncated ? INPUT_FLAG_TRUNCATED : 0);
+    offset += 8;
+    for (u16 i = 0; i < inputRunCount; i++) {
+        SRAM_writeWord(offset, inputRuns[i].buttons);
+        SRAM_writeWord(offset + 2, inputRuns[i].frames);
+        offset += 4;
+    }
+    SRAM_disable();
+    return TRUE;
+}
+
+/**
+ * @brief Lee de SRAM una grabación guardada con gameCore_saveInputRecording.
+ * @return FALSE si la cabecera no es válida.
+ */
+u8 gameCore_loadInputRecording(void) {
+    u32 offset = GAME_INPUT_SRAM_OFFSET;
+    SRAM_enableRO();
+    const u16 magic = SRAM_readWord(offset);
+    const u16 count = SRAM_readWord(offset + 4);
+    if (magic != INPUT_SRAM_MAGIC || count == 0 || count > GAME_INPUT_MAX_RUNS) {
+        SRAM_disable();
+        return FALSE;
+    }
+    inputSeed = SRAM_readWord(offset + 2);
+    const u16 flags = SRAM_readWord(offset + 6);
+    offset += 8;
+    for (u16 i = 0; i < count; i++) {
+        inputRuns[i].buttons = SRAM_readWord(offset);
+        inputRuns[i].frames = SRAM_readWord(offset + 2);
+        offset += 4;
+    }
+    SRAM_disable();
+    inputRunCount = count;
+    inputTruncated = (flags & INPUT_FLAG_TRUNCATED) ? TRUE : FALSE;
+    return TRUE;
 }
 
 /**
@@ -48,17 +263,435 @@ s32 gameCore_updateTimer(GameTimer *timer) {
 /**
  * @brief Fade a negro en audio y paletas.
  *
- * Usa la API corregida de SGDK para realizar el fundido y limpiar fondo.
+ * Lanza el fundido asíncrono y espera a que termine para limpiar fondo.
  */
 void gameCore_fadeToBlack(void) {
-    XGM2_fadeOut(60);              /* Fade música */
-    PAL_fadeOutAll(60, FALSE);     /* Fade paletas */
+    gameCore_startFadeOut(GAME_FADE_FRAMES, TRUE);
+    gameCore_waitFade();
     VDP_setBackgroundColor(0);     /* Color negro */
 }
 
-/** @brief Reinicia el índice global de tiles al valor por defecto. */
-void gameCore_resetTileIndex(void) {
-    globalTileIndex = TILE_USER_INDEX;
+/**
+ * @brief Busca el primer hueco libre de numTile tiles desde TILE_USER_INDEX.
+ * @param numTile Tiles necesarios.
+ * @param slot Recibe la posición de inserción en la tabla ordenada.
+ * @return Primer tile del hueco (puede sobrepasar el área de usuario).
+ */
+static u16 vramFindLow(u16 numTile, u8 *slot) {
+    u16 cursor = TILE_USER_INDEX;
+    for (u8 i = 0; i < vramRegionCount; i++) {
+        if ((u16)(vramRegions[i].base - cursor) >= numTile) {
+            *slot = i;
+            return cursor;
+        }
+        cursor = vramRegions[i].base + vramRegions[i].size;
+    }
+    *slot = vramRegionCount;
+    return cursor;
+}
+
+/**
+ * @brief Busca el último hueco libre de numTile tiles bajo TILE_SPRITE_INDEX.
+ * @param numTile Tiles necesarios.
+ * @param slot Recibe la posición de inserción en la tabla ordenada.
+ * @return Primer tile del hueco o GAME_VRAM_NONE si no cabe.
+ */
+static u16 vramFindHigh(u16 numTile, u8 *slot) {
+    u16 cursor = TILE_SPRITE_INDEX;
+    for (u8 i = vramRegionCount; i > 0; i--) {
+        const GameVramRegion *region = &vramRegions[i - 1];
+        const u16 end = region->base + region->size;
+        if (cursor >= end && (u16)(cursor - end) >= numTile) {
+            *slot = i;
+            return cursor - numTile;
+        }
+        cursor = region->base;
+    }
+    if (cursor >= TILE_USER_INDEX && (u16)(cursor - TILE_USER_INDEX) >= numTile) {
+        *slot = 0;
+        return cursor - numTile;
+    }
+    return GAME_VRAM_NONE;
+}
+
+/**
+ * @brief Inserta una región en la posición indicada y comprueba sus límites.
+ * @return Primer tile de la región.
+ */
+static u16 vramInsert(u8 slot, const char *name, u16 base, u16 numTile, u8 flags) {
+    if (base + numTile > TILE_SPRITE_INDEX) {
+        GAME_PROF_LOG("VRAM: '%s' (%u tiles en %u) invade el area de sprites (%u)",
+            name, numTile, base, (u16)TILE_SPRITE_INDEX);
+    }
+    if (vramRegionCount >= GAME_VRAM_MAX_REGIONS) {
+        GAME_PROF_LOG("VRAM: tabla llena, '%s' sin registrar", name);
+        return base;
+    }
+
+    for (u8 i = vramRegionCount; i > slot; i--) {
+        vramRegions[i] = vramRegions[i - 1];
+    }
+    vramRegions[slot].name = name;
+    vramRegions[slot].base = base;
+    vramRegions[slot].size = numTile;
+    vramRegions[slot].flags = flags;
+    vramRegionCount++;
+
+    vramUsed += numTile;
+    if (vramUsed > vramHighWater) vramHighWater = vramUsed;
+    return base;
+}
+
+/** @brief Quita la región de la posición indicada de la tabla. */
+static void vramRemoveAt(u8 slot) {
+    vramUsed -= vramRegions[slot].size;
+    vramRegionCount--;
+    for (u8 i = slot; i < vramRegionCount; i++) {
+        vramRegions[i] = vramRegions[i + 1];
+    }
+}
+
+/** @brief Posición en la tabla de la región con ese nombre o GAME_VRAM_MAX_REGIONS. */
+static u8 vramIndexOf(const char *name) {
+    for (u8 i = 0; i < vramRegionCount; i++) {
+        if (vramRegions[i].name == name || strcmp(vramRegions[i].name, name) == 0) return i;
+    }
+    return GAME_VRAM_MAX_REGIONS;
+}
+
+/** @brief Reserva tiles en el primer hueco libre con los flags indicados. */
+static u16 vramAllocLow(const char *name, u16 numTile, u8 flags) {
+    u8 slot;
+    const u16 base = vramFindLow(numTile, &slot);
+    return vramInsert(slot, name, base, numTile, flags);
+}
+
+/** @brief Reserva tiles de fase en el primer hueco libre. */
+u16 gameCore_vramAlloc(const char *name, u16 numTile) {
+    return vramAllocLow(name, numTile, 0);
+}
+
+/** @brief Reserva o recupera una región residente colocada desde el final. */
+u16 gameCore_vramAllocResident(const char *name, u16 numTile, u8 *loaded) {
+    const u8 index = vramIndexOf(name);
+    if (index < GAME_VRAM_MAX_REGIONS && vramRegions[index].size >= numTile) {
+        if (loaded != NULL) *loaded = TRUE;
+        return vramRegions[index].base;
+    }
+    if (index < GAME_VRAM_MAX_REGIONS) {
+        vramRemoveAt(index);
+    }
+    if (loaded != NULL) *loaded = FALSE;
+
+    u8 slot;
+    u16 base = vramFindHigh(numTile, &slot);
+    if (base == GAME_VRAM_NONE) {
+        base = vramFindLow(numTile, &slot);
+    }
+    return vramInsert(slot, name, base, numTile, GAME_VRAM_RESIDENT);
+}
+
+/** @brief Libera la región que empieza en base. */
+void gameCore_vramFree(u16 base) {
+    for (u8 i = 0; i < vramRegionCount; i++) {
+        if (vramRegions[i].base == base) {
+            vramRemoveAt(i);
+            return;
+        }
+    }
+}
+
+/** @brief Libera las regiones de fase, consume las precargas y reinicia el pico. */
+void gameCore_vramReleasePhase(void) {
+    u8 kept = 0;
+    vramUsed = 0;
+    for (u8 i = 0; i < vramRegionCount; i++) {
+        if (vramRegions[i].flags & (GAME_VRAM_RESIDENT | GAME_VRAM_PRELOAD)) {
+            vramRegions[i].flags &= ~GAME_VRAM_PRELOAD;
+            vramRegions[kept++] = vramRegions[i];
+            vramUsed += vramRegions[i].size;
+        }
+    }
+    vramRegionCount = kept;
+    vramHighWater = vramUsed;
+}
+
+/** @brief Primer tile de la región con ese nombre o GAME_VRAM_NONE. */
+u16 gameCore_vramFind(const char *name) {
+    const u8 index = vramIndexOf(name);
+    return (index < GAME_VRAM_MAX_REGIONS) ? vramRegions[index].base : GAME_VRAM_NONE;
+}
+
+/** @brief Tiles de usuario reservados ahora mismo. */
+u16 gameCore_vramGetUsed(void) {
+    return vramUsed;
+}
+
+/** @brief Pico de tiles reservados en la fase actual. */
+u16 gameCore_vramGetHighWater(void) {
+    return vramHighWater;
+}
+
+#if GAME_PROFILE
+/** @brief Vuelca regiones y pico de la fase por KDebug. */
+void gameCore_vramReport(void) {
+    kprintf("VRAM: %u/%u tiles en uso, pico %u",
+        vramUsed, (u16)(TILE_SPRITE_INDEX - TILE_USER_INDEX), vramHighWater);
+    for (u8 i = 0; i < vramRegionCount; i++) {
+        const u8 flags = vramRegions[i].flags;
+        kprintf("  %s: %u+%u%s", vramRegions[i].name, vramRegions[i].base, vramRegions[i].size,
+            (flags & GAME_VRAM_RESIDENT) ? " (residente)" : (flags & GAME_VRAM_PRELOAD) ? " (precarga)" : "");
+    }
+}
+#endif
+
+/** @brief Reserva un hueco al final de la cola o NULL si está llena. */
+static GameDmaJob* dmaPush(void) {
+    if (dmaCount >= GAME_DMA_QUEUE_SLOTS) return NULL;
+    GameDmaJob *job = &dmaJobs[(dmaHead + dmaCount) & (GAME_DMA_QUEUE_SLOTS - 1)];
+    dmaCount++;
+    memset(job, 0, sizeof(GameDmaJob));
+    return job;
+}
+
+/** @brief Encola un tileset por tramos; carga por CPU si no es posible. */
+u8 gameCore_dmaQueueTileSet(const TileSet *tileset, u16 index, GameDmaCallback *done) {
+    if (tileset == NULL) return FALSE;
+
+    TileSet *unpacked = NULL;
+    const u32 *data = tileset->tiles;
+    if (tileset->compression != COMPRESSION_NONE) {
+        unpacked = unpackTileSet(tileset, NULL);
+        data = (unpacked != NULL) ? unpacked->tiles : NULL;
+    }
+
+    GameDmaJob *job = (data != NULL) ? dmaPush() : NULL;
+    if (job == NULL) {
+        GAME_PROF_LOG("DMA: cola llena, tileset cargado por CPU");
+        if (unpacked != NULL) MEM_free(unpacked);
+        VDP_loadTileSet(tileset, index, CPU);
+        if (done != NULL) done();
+        return FALSE;
+    }
+
+    job->data = data;
+    job->unpacked = unpacked;
+    job->index = index;
+    job->remaining = tileset->numTile;
+    job->done = done;
+    return TRUE;
+}
+
+/** @brief Encola un callback detrás de los trabajos existentes. */
+u8 gameCore_dmaQueueCallback(GameDmaCallback *done) {
+    GameDmaJob *job = dmaPush();
+    if (job == NULL) {
+        if (done != NULL) done();
+        return FALSE;
+    }
+    job->done = done;
+    return TRUE;
+}
+
+/** @brief Lanza el fundido pendiente de gameCore_dmaFadeInWhenDone. */
+static void dmaApplyFade(void) {
+    gameCore_startPaletteFade(dmaFadePal * 16, (dmaFadePal * 16) + 15, dmaFadeColors, dmaFadeFrames);
+}
+
+/** @brief Oscurece la paleta y la funde al vaciarse la cola. */
+void gameCore_dmaFadeInWhenDone(u16 numPal, const u16 *pal, u16 numFrame) {
+    if (pal == NULL) return;
+    PAL_setPalette(numPal, blackColors, CPU);
+    dmaFadePal = numPal;
+    dmaFadeColors = pal;
+    dmaFadeFrames = numFrame;
+    gameCore_dmaQueueCallback(dmaApplyFade);
+}
+
+/** @brief Ajusta el presupuesto de bytes por VBlank (mínimo un tile). */
+void gameCore_dmaSetBudget(u16 bytesPerFrame) {
+    dmaBudgetTiles = bytesPerFrame / TILE_SIZE;
+    if (dmaBudgetTiles == 0) dmaBudgetTiles = 1;
+}
+
+/** @brief Cierra trabajos transferidos y encola tramos dentro del presupuesto. */
+void gameCore_dmaProcess(void) {
+    /* Lo encolado en el frame anterior ya pasó por VBlank: se puede cerrar. */
+    while (dmaCount > 0 && dmaJobs[dmaHead].remaining == 0) {
+        GameDmaJob *job = &dmaJobs[dmaHead];
+        GameDmaCallback *done = job->done;
+        if (job->unpacked != NULL) MEM_free(job->unpacked);
+        dmaHead = (dmaHead + 1) & (GAME_DMA_QUEUE_SLOTS - 1);
+        dmaCount--;
+        if (done != NULL) done();
+    }
+
+    u16 budget = dmaBudgetTiles;
+    for (u8 n = 0; n < dmaCount && budget > 0; n++) {
+        GameDmaJob *job = &dmaJobs[(dmaHead + n) & (GAME_DMA_QUEUE_SLOTS - 1)];
+        if (job->remaining == 0) continue;
+
+        const u16 chunk = (job->remaining < budget) ? job->remaining : budget;
+        VDP_loadTileData(job->data, job->index, chunk, DMA_QUEUE);
+        job->data += chunk * (TILE_SIZE / 4);
+        job->index += chunk;
+        job->remaining -= chunk;
+        budget -= chunk;
+    }
+}
+
+/** @brief TRUE si la cola está vacía. */
+u8 gameCore_dmaIsIdle(void) {
+    return dmaCount == 0;
+}
+
+/** @brief Fundido de todas las paletas a negro, opcionalmente con la música. */
+void gameCore_startFadeOut(u16 numFrame, u8 fadeMusic) {
+    if (fadeMusic) {
+        XGM2_fadeOut(numFrame);
+    }
+    gameCore_startPaletteFade(0, 63, blackColors, numFrame);
+}
+
+/** @brief Prepara un fundido desde los colores actuales. */
+void gameCore_startPaletteFade(u16 fromCol, u16 toCol, const u16 *palDst, u16 numFrame) {
+    if (palDst == NULL || toCol < fromCol || toCol > 63) return;
+    const u16 count = toCol - fromCol + 1;
+    PAL_getColors(fromCol, fadeColors, count);
+    fadeActive = PAL_initFade(fromCol, toCol, fadeColors, palDst, numFrame);
+}
+
+/** @brief Un paso de PAL_doFadeStep si hay fundido activo. */
+void gameCore_updateFade(void) {
+    if (fadeActive) {
+        fadeActive = PAL_doFadeStep();
+    }
+}
+
+/** @brief TRUE si el fundido sigue en curso. */
+u8 gameCore_isFading(void) {
+    return fadeActive;
+}
+
+/** @brief Bloquea hasta el final del fundido sin dejar de procesar la cola. */
+void gameCore_waitFade(void) {
+    while (fadeActive) {
+        gameCore_waitVBlank();
+    }
+}
+
+/** @brief Paso de fundido y de cola seguido del VBlank. */
+void gameCore_waitVBlank(void) {
+    gameCore_updateFade();
+    gameCore_dmaProcess();
+    GAME_PROF_END_FRAME();
+    SYS_doVBlankProcess();
+    GAME_PROF_BEGIN_FRAME();
+}
+
+/** @brief Bloquea hasta que todos los trabajos y callbacks han terminado. */
+void gameCore_dmaFlush(void) {
+    while (!gameCore_dmaIsIdle()) {
+        gameCore_waitVBlank();
+    }
+}
+
+/** @brief Vacía la cola liberando las copias descomprimidas. */
+void gameCore_dmaReset(void) {
+    while (dmaCount > 0) {
+        if (dmaJobs[dmaHead].unpacked != NULL) MEM_free(dmaJobs[dmaHead].unpacked);
+        dmaHead = (dmaHead + 1) & (GAME_DMA_QUEUE_SLOTS - 1);
+        dmaCount--;
+    }
+}
+
+/** @brief Registra la tarea (o la reinicia si ya estaba viva). */
+u8 gameCore_taskStart(GameTask *task, GameTaskFunc *run, void *data) {
+    if (task == NULL || run == NULL) return FALSE;
+
+    task->run = run;
+    task->line = 0;
+    task->data = data;
+    for (u8 i = 0; i < taskCount; i++) {
+        if (tasks[i] == task) return TRUE;
+    }
+    if (taskCount >= GAME_TASK_MAX) {
+        GAME_PROF_LOG("Task: planificador lleno");
+        task->run = NULL;
+        return FALSE;
+    }
+    tasks[taskCount++] = task;
+    return TRUE;
+}
+
+/** @brief Marca la tarea como terminada. */
+void gameCore_taskStop(GameTask *task) {
+    if (task != NULL) task->run = NULL;
+}
+
+/** @brief TRUE si la tarea sigue viva. */
+u8 gameCore_taskIsRunning(const GameTask *task) {
+    return (task != NULL && task->run != NULL);
+}
+
+/** @brief Un paso por tarea; las terminadas salen conservando el orden. */
+void gameCore_taskStep(void) {
+    u8 i = 0;
+    while (i < taskCount) {
+        GameTask *task = tasks[i];
+        if (task->run != NULL && task->run(task) == GAME_TASK_RUNNING && task->run != NULL) {
+            i++;
+            continue;
+        }
+        task->run = NULL;
+        taskCount--;
+        for (u8 j = i; j < taskCount; j++) {
+            tasks[j] = tasks[j + 1];
+        }
+    }
+}
+
+/** @brief Bombea tareas y VBlank hasta que la tarea indicada termina. */
+void gameCore_taskRun(GameTask *task, GameTaskFunc *run, void *data) {
+    if (task == NULL || run == NULL) return;
+
+    /* Sin hueco en el planificador la tarea avanza aquí, tras las demás: una
+     * escena o el menú de idioma no se pueden saltar. */
+    const u8 scheduled = gameCore_taskStart(task, run, data);
+    if (!scheduled) {
+        task->run = run;
+        task->line = 0;
+        task->data = data;
+    }
+    while (TRUE) {
+        gameCore_taskStep();
+        if (!scheduled && task->run != NULL && task->run(task) != GAME_TASK_RUNNING) {
+            task->run = NULL;
+        }
+        if (!gameCore_taskIsRunning(task)) break;
+        gameCore_waitVBlank();
+    }
+}
+
+/** @brief Reserva una región de precarga y encola su subida. */
+u16 gameCore_vramPreload(const char *name, const TileSet *tileset) {
+    if (tileset == NULL) return GAME_VRAM_NONE;
+    const u16 existing = gameCore_vramFind(name);
+    if (existing != GAME_VRAM_NONE) return existing;
+
+    const u16 base = vramAllocLow(name, tileset->numTile, GAME_VRAM_PRELOAD);
+    gameCore_dmaQueueTileSet(tileset, base, NULL);
+    return base;
+}
+
+/** @brief Recupera una precarga o reserva y encola el tileset en el acto. */
+u16 gameCore_vramBind(const char *name, const TileSet *tileset) {
+    const u16 existing = gameCore_vramFind(name);
+    if (existing != GAME_VRAM_NONE || tileset == NULL) return existing;
+
+    const u16 base = gameCore_vramAlloc(name, tileset->numTile);
+    gameCore_dmaQueueTileSet(tileset, base, NULL);
+    return base;
 }
 
 /**
@@ -72,10 +705,12 @@ void gameCore_resetVideoState(void) {
     SPR_end();
     VDP_resetSprites();
     SPR_init();
+    gameCore_sprCacheReset();
 
     VDP_setScreenWidth320();
     VDP_setScreenHeight224();
     VDP_setPlaneSize(64, 64, TRUE);
+    VDP_setScrollingMode(HSCROLL_PLANE, VSCROLL_PLANE);
     VDP_setHorizontalScroll(BG_A, 0);
     VDP_setHorizontalScroll(BG_B, 0);
     VDP_setVerticalScroll(BG_A, 0);
@@ -84,7 +719,9 @@ void gameCore_resetVideoState(void) {
     VDP_clearPlane(BG_B, TRUE);
     VDP_setBackgroundColor(0);
 
-    gameCore_resetTileIndex();
+    gameCore_dmaReset();
+    gameCore_vramReleasePhase();
+    gameCore_qualityReset();
     SYS_doVBlankProcess();
 }
 
@@ -143,5 +780,799 @@ void gameCore_applyInertiaMovement(s16 *x, s16 *y, s8 *vx, s8 *vy,
  * @brief Comprueba solapamiento de dos AABB sencillas.
  */
 u8 gameCore_checkCollision(s16 x1, s16 y1, s16 w1, s16 h1, s16 x2, s16 y2, s16 w2, s16 h2) {
+    GAME_PROF_COUNT(GAME_PROF_CHECK_COLLISION);
     return (x1 < x2 + w2) && (x1 + w1 > x2) && (y1 < y2 + h2) && (y1 + h1 > y2);
 }
+
+/* Rejilla de colisiones: listas enlazadas por celda sobre pools fijos. */
+static GameGridEntry gridEntries[GAME_GRID_MAX_ENTRIES]; /**< Cajas registradas este frame. */
+static u8 gridEntryCount = 0;                             /**< Entradas usadas. */
+static u8 gridCellHead[GAME_GRID_COLS * GAME_GRID_ROWS];  /**< Primer enlace de cada celda. */
+static u8 gridLinkEntry[GAME_GRID_MAX_LINKS];             /**< Entrada de cada enlace. */
+static u8 gridLinkNext[GAME_GRID_MAX_LINKS];              /**< Siguiente enlace de la celda. */
+static u8 gridLinkCount = 0;                              /**< Enlaces usados. */
+static u8 gridQueryStamp[GAME_GRID_MAX_ENTRIES];          /**< Marca de la última consulta que vio la entrada. */
+static u8 gridStamp = 0;                                  /**< Marca de la consulta en curso. */
+
+/** @brief Convierte una coordenada X de pantalla en columna (saturada al borde). */
+static u8 gridColumn(s16 x) {
+    if (x < 0) return 0;
+    const s16 col = x >> GAME_GRID_CELL_SHIFT;
+    return (col >= GAME_GRID_COLS) ? (GAME_GRID_COLS - 1) : (u8)col;
+}
+
+/** @brief Convierte una coordenada Y de pantalla en fila (saturada al borde). */
+static u8 gridRow(s16 y) {
+    if (y < 0) return 0;
+    const s16 row = y >> GAME_GRID_CELL_SHIFT;
+    return (row >= GAME_GRID_ROWS) ? (GAME_GRID_ROWS - 1) : (u8)row;
+}
+
+/** @brief Avanza la marca de consulta, limpiando las marcas al dar la vuelta. */
+static void gridNextStamp(void) {
+    gridStamp++;
+    if (gridStamp == 0) {
+        memset(gridQueryStamp, 0, sizeof(gridQueryStamp));
+        gridStamp = 1;
+    }
+}
+
+void gameCore_gridClear(void) {
+    memset(gridCellHead, GAME_GRID_NONE, sizeof(gridCellHead));
+    gridEntryCount = 0;
+    gridLinkCount = 0;
+}
+
+u8 gameCore_gridAdd(s16 x, s16 y, s16 w, s16 h, u8 layer, u8 id) {
+    if (gridEntryCount >= GAME_GRID_MAX_ENTRIES || w <= 0 || h <= 0) return GAME_GRID_NONE;
+
+    const u8 entry = gridEntryCount;
+    const u8 col0 = gridColumn(x);
+    const u8 col1 = gridColumn(x + w - 1);
+    const u8 row0 = gridRow(y);
+    const u8 row1 = gridRow(y + h - 1);
+
+    /* Todo o nada: una entrada enlazada a medias se perdería en las consultas. */
+    const u16 links = (u16)(row1 - row0 + 1) * (u16)(col1 - col0 + 1);
+    if (gridLinkCount + links > GAME_GRID_MAX_LINKS) {
+        GAME_PROF_LOG("Grid: sin enlaces libres (entrada %u)", entry);
+        return GAME_GRID_NONE;
+    }
+
+    GameGridEntry *e = &gridEntries[entry];
+    e->x = x;
+    e->y = y;
+    e->w = w;
+    e->h = h;
+    e->layer = layer;
+    e->id = id;
+    gridQueryStamp[entry] = 0;
+
+    for (u8 row = row0; row <= row1; row++) {
+        u8 *head = &gridCellHead[row * GAME_GRID_COLS + col0];
+        for (u8 col = col0; col <= col1; col++, head++) {
+            gridLinkEntry[gridLinkCount] = entry;
+            gridLinkNext[gridLinkCount] = *head;
+            *head = gridLinkCount;
+            gridLinkCount++;
+        }
+    }
+
+    gridEntryCount++;
+    return entry;
+}
+
+const GameGridEntry* gameCore_gridGetEntry(u8 entry) {
+    if (entry >= gridEntryCount) return NULL;
+    return &gridEntries[entry];
+}
+
+u8 gameCore_gridQuery(s16 x, s16 y, s16 w, s16 h, u8 layerMask, u8 *outEntries, u8 maxOut) {
+    if (outEntries == NULL || maxOut == 0 || w <= 0 || h <= 0) return 0;
+    gridNextStamp();
+
+    u8 count = 0;
+    const u8 col0 = gridColumn(x);
+    const u8 col1 = gridColumn(x + w - 1);
+    const u8 row0 = gridRow(y);
+    const u8 row1 = gridRow(y + h - 1);
+    for (u8 row = row0; row <= row1; row++) {
+        for (u8 col = col0; col <= col1; col++) {
+            for (u8 link = gridCellHead[row * GAME_GRID_COLS + col]; link != GAME_GRID_NONE; link = gridLinkNext[link]) {
+                const u8 entry = gridLinkEntry[link];
+                if (gridQueryStamp[entry] == gridStamp) continue;
+                gridQueryStamp[entry] = gridStamp;
+
+                const GameGridEntry *e = &gridEntries[entry];
+                if (!(e->layer & layerMask)) continue;
+                if (!gameCore_checkCollision(x, y, w, h, e->x, e->y, e->w, e->h)) continue;
+
+                /* Inserción ordenada: la lista es corta y conserva el orden de registro. */
+                u8 pos = (count < maxOut) ? count : maxOut - 1;
+                if (count == maxOut && entry > outEntries[pos]) continue;
+                while (pos > 0 && outEntries[pos - 1] > entry) {
+                    outEntries[pos] = outEntries[pos - 1];
+                    pos--;
+                }
+                outEntries[pos] = entry;
+                if (count < maxOut) count++;
+            }
+        }
+    }
+    return count;
+}
+
+/* Pool de entidades: máscara de vivos + pila de slots libres. */
+void gameCore_poolInit(GameEntityPool *pool, u8 capacity) {
+    if (pool == NULL) return;
+    if (capacity > GAME_POOL_MAX_SLOTS) capacity = GAME_POOL_MAX_SLOTS;
+    pool->activeMask = 0;
+    pool->capacity = capacity;
+    pool->freeCount = capacity;
+    /* Apilados al revés para que el primer alloc devuelva el slot 0. */
+    for (u8 i = 0; i < capacity; i++) {
+        pool->freeList[i] = capacity - 1 - i;
+    }
+}
+
+u8 gameCore_poolAlloc(GameEntityPool *pool) {
+    if (pool == NULL || pool->freeCount == 0) return GAME_POOL_NONE;
+    const u8 slot = pool->freeList[--pool->freeCount];
+    pool->activeMask |= (u16)(1 << slot);
+    return slot;
+}
+
+u8 gameCore_poolAcquire(GameEntityPool *pool, u8 slot) {
+    if (pool == NULL || slot >= pool->capacity) return FALSE;
+    if (pool->activeMask & (1 << slot)) return FALSE;
+    for (u8 i = 0; i < pool->freeCount; i++) {
+        if (pool->freeList[i] == slot) {
+            pool->freeList[i] = pool->freeList[--pool->freeCount];
+            break;
+        }
+    }
+    pool->activeMask |= (u16)(1 << slot);
+    return TRUE;
+}
+
+void gameCore_poolRelease(GameEntityPool *pool, u8 slot) {
+    if (pool == NULL || slot >= pool->capacity) return;
+    if (!(pool->activeMask & (1 << slot))) return;
+    pool->activeMask &= (u16)~(1 << slot);
+    pool->freeList[pool->freeCount++] = slot;
+}
+
+u8 gameCore_poolIsActive(const GameEntityPool *pool, u8 slot) {
+    if (pool == NULL || slot >= pool->capacity) return FALSE;
+    return (pool->activeMask & (1 << slot)) != 0;
+}
+
+u8 gameCore_poolNextSlot(u16 *mask) {
+    /* Bit más bajo de cada nibble; evita recorrer la máscara bit a bit. */
+    static const u8 lowestBit[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+    if (mask == NULL || *mask == 0) return GAME_POOL_NONE;
+
+    u16 bits = *mask;
+    u8 base = 0;
+    while ((bits & 0x0F) == 0) {
+        bits >>= 4;
+        base += 4;
+    }
+    *mask &= *mask - 1;
+    return base + lowestBit[bits & 0x0F];
+}
+
+/* Reparto de IA: ventana de turnos que gira sobre los slots. */
+void gameCore_aiSlicerInit(GameAiSlicer *slicer, u8 count, u8 perFrame) {
+    if (slicer == NULL) return;
+    if (count > GAME_POOL_MAX_SLOTS) count = GAME_POOL_MAX_SLOTS;
+    if (perFrame == 0) perFrame = 1;
+    if (perFrame > count) perFrame = count;
+    slicer->count = count;
+    slicer->perFrame = perFrame;
+    slicer->cursor = 0;
+}
+
+u16 gameCore_aiSlicerNext(GameAiSlicer *slicer) {
+    if (slicer == NULL || slicer->count == 0) return 0;
+    u16 turn = 0;
+    u8 slot = slicer->cursor;
+    for (u8 i = 0; i < slicer->perFrame; i++) {
+        turn |= (u16)(1 << slot);
+        if (++slot >= slicer->count) slot = 0;
+    }
+    slicer->cursor = slot;
+    return turn;
+}
+
+/* Trayectorias rectas: Bresenham por el eje mayor. */
+void gameCore_lineInit(GameLineStepper *line, s16 x0, s16 y0, s16 x1, s16 y1, u8 speed) {
+    if (line == NULL) return;
+    const s16 dx = x1 - x0;
+    const s16 dy = y1 - y0;
+    const u16 absDx = (dx < 0) ? -dx : dx;
+    const u16 absDy = (dy < 0) ? -dy : dy;
+
+    line->x = x0;
+    line->y = y0;
+    line->stepX = (dx > 0) - (dx < 0);
+    line->stepY = (dy > 0) - (dy < 0);
+    line->xMajor = (absDx >= absDy);
+    line->major = line->xMajor ? absDx : absDy;
+    line->minor = line->xMajor ? absDy : absDx;
+    line->remaining = line->major;
+    line->err = (s16)(line->major >> 1);
+    line->speed = speed;
+}
+
+u8 gameCore_lineAdvance(GameLineStepper *line, u16 steps) {
+    if (line == NULL) return TRUE;
+    if (steps > line->remaining) steps = line->remaining;
+    line->remaining -= steps;
+
+    if (line->xMajor) {
+        while (steps--) {
+            line->x += line->stepX;
+            line->err -= line->minor;
+            if (line->err < 0) {
+                line->err += line->major;
+                line->y += line->stepY;
+            }
+        }
+    } else {
+        while (steps--) {
+            line->y += line->stepY;
+            line->err -= line->minor;
+            if (line->err < 0) {
+                line->err += line->major;
+                line->x += line->stepX;
+            }
+        }
+    }
+    return (line->remaining == 0);
+}
+
+u8 gameCore_lineStep(GameLineStepper *line) {
+    if (line == NULL) return TRUE;
+    return gameCore_lineAdvance(line, line->speed);
+}
+
+void gameCore_lineShift(GameLineStepper *line, s16 offsetX, s16 offsetY) {
+    if (line == NULL) return;
+    line->x += offsetX;
+    line->y += offsetY;
+}
+
+/* Listas de profundidad: orden persistente corregido por inserción. */
+#define DEPTH_FLAG_SEEN 0x01    /* Enviado en el frame en curso. */
+#define DEPTH_FLAG_PLACED 0x02  /* depth refleja lo aplicado al sprite. */
+
+void gameCore_depthInit(GameDepthList *list, s16 baseDepth) {
+    if (list == NULL) return;
+    list->count = 0;
+    list->baseDepth = baseDepth;
+    list->depthCalls = 0;
+}
+
+void gameCore_depthBegin(GameDepthList *list) {
+    if (list == NULL) return;
+    for (u8 i = 0; i < list->count; i++) {
+        list->entries[i].flags &= ~DEPTH_FLAG_SEEN;
+    }
+}
+
+void gameCore_depthSubmit(GameDepthList *list, Sprite *sprite, s16 key) {
+    if (list == NULL || sprite == NULL) return;
+    for (u8 i = 0; i < list->count; i++) {
+        GameDepthEntry *e = &list->entries[i];
+        if (e->sprite == sprite) {
+            e->key = key;
+            e->flags |= DEPTH_FLAG_SEEN;
+            return;
+        }
+    }
+    if (list->count >= GAME_DEPTH_MAX_ENTRIES) {
+        GAME_PROF_LOG("Depth: lista llena, sprite sin ordenar");
+        return;
+    }
+    /* Entra por detrás; la inserción lo lleva a su puesto en el commit. */
+    GameDepthEntry *e = &list->entries[list->count++];
+    e->sprite = sprite;
+    e->key = key;
+    e->depth = 0;
+    e->flags = DEPTH_FLAG_SEEN;
+}
+
+u16 gameCore_depthCommit(GameDepthList *list) {
+    if (list == NULL) return 0;
+    GameDepthEntry *entries = list->entries;
+
+    /* Compacta quitando los no enviados sin alterar el orden relativo. */
+    u8 count = 0;
+    for (u8 i = 0; i < list->count; i++) {
+        if (!(entries[i].flags & DEPTH_FLAG_SEEN)) continue;
+        if (count != i) entries[count] = entries[i];
+        count++;
+    }
+    list->count = count;
+
+    /* Inserción estable: con la lista casi ordenada cada paso es O(1) y los empates no se mueven. */
+    for (u8 i = 1; i < count; i++) {
+        if (entries[i - 1].key >= entries[i].key) continue;
+        const GameDepthEntry moving = entries[i];
+        u8 j = i;
+        while (j > 0 && entries[j - 1].key < moving.key) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = moving;
+    }
+
+    u16 calls = 0;
+    s16 depth = list->baseDepth;
+    for (u8 i = 0; i < count; i++, depth++) {
+        GameDepthEntry *e = &entries[i];
+        if ((e->flags & DEPTH_FLAG_PLACED) && e->depth == depth) continue;
+        gameCore_sprSetDepth(e->sprite, depth);
+        e->depth = depth;
+        e->flags |= DEPTH_FLAG_PLACED;
+        calls++;
+    }
+    list->depthCalls = calls;
+    return calls;
+}
+
+/* Plano en bucle: el mapa se copia fila a fila al plano y solo se mueve el scroll. */
+void gameCore_loopPlaneInit(GameLoopPlane *loop, const MapDefinition *mapDef, VDPPlane plane,
+    u16 baseTile, u16 widthPx, u16 heightPx, s16 offsetY) {
+    if (loop == NULL) return;
+    loop->map = NULL;
+    loop->plane = plane;
+    loop->offsetY = offsetY;
+    if (mapDef == NULL) return;
+
+    Map *map = MAP_create(mapDef, plane, baseTile);
+    if (map == NULL) return;
+
+    const u16 cols = widthPx / 8;
+    if ((heightPx != GAME_PLANE_ROWS * 8) || (cols > GAME_PLANE_COLS)) {
+        /* No envuelve con el plano: respaldo con el motor de mapas. */
+        loop->map = map;
+        MAP_scrollTo(map, 0, offsetY);
+        return;
+    }
+
+    u16 row[GAME_PLANE_COLS];
+    for (u16 y = 0; y < GAME_PLANE_ROWS; y++) {
+        MAP_getTilemapRect(map, 0, y, cols, 1, FALSE, row);
+        VDP_setTileMapDataRectEx(plane, row, 0, 0, y, cols, 1, cols, CPU);
+    }
+    MAP_release(map);
+    VDP_setVerticalScroll(plane, offsetY);
+}
+
+void gameCore_loopPlaneScroll(GameLoopPlane *loop, s16 offsetY) {
+    if (loop == NULL || loop->offsetY == offsetY) return;
+    loop->offsetY = offsetY;
+    if (loop->map != NULL) {
+        MAP_scrollTo(loop->map, 0, offsetY);
+    } else {
+        VDP_setVerticalScroll(loop->plane, offsetY);
+    }
+}
+
+void gameCore_loopPlaneRelease(GameLoopPlane *loop) {
+    if (loop == NULL || loop->map == NULL) return;
+    MAP_release(loop->map);
+    loop->map = NULL;
+}
+
+/* Caché de atributos de sprite: último valor aplicado por sprite. */
+#define SHADOW_POSITION 0x01    /* x/y conocidos. */
+#define SHADOW_VISIBILITY 0x02  /* visibility conocida. */
+#define SHADOW_DEPTH 0x04       /* depth conocida. */
+#define SHADOW_HFLIP 0x08       /* hflip conocido. */
+
+typedef struct {
+    Sprite *sprite;   /**< Dueño de la entrada (NULL si libre). */
+    s16 x;            /**< Última X aplicada. */
+    s16 y;            /**< Última Y aplicada. */
+    s16 depth;        /**< Última profundidad aplicada. */
+    u8 visibility;    /**< Última visibilidad aplicada. */
+    u8 hflip;         /**< Último volteo horizontal aplicado. */
+    u8 known;         /**< Bits SHADOW_* de los campos válidos. */
+} SpriteShadow;
+
+static SpriteShadow spriteShadow[GAME_SPRITE_CACHE_SLOTS]; /**< Estado sombra por sprite. */
+static u8 spriteShadowUsed = 0;                            /**< Entradas repartidas alguna vez. */
+static GameSpriteCacheStats spriteCacheStats;              /**< Llamadas reenviadas/evitadas. */
+
+/**
+ * @brief Devuelve la entrada sombra del sprite, creándola si no tiene.
+ * @return NULL si la tabla está llena (la llamada se reenvía sin caché).
+ */
+static SpriteShadow* spriteShadowFor(Sprite *sprite) {
+    const u32 handle = sprite->data;
+    if (handle > 0 && handle <= GAME_SPRITE_CACHE_SLOTS) {
+        SpriteShadow *entry = &spriteShadow[handle - 1];
+        if (entry->sprite == sprite) return entry;
+    }
+
+    u8 slot = spriteShadowUsed;
+    if (slot < GAME_SPRITE_CACHE_SLOTS) {
+        spriteShadowUsed++;
+    } else {
+        for (slot = 0; slot < GAME_SPRITE_CACHE_SLOTS; slot++) {
+            if (spriteShadow[slot].sprite == NULL) break;
+        }
+        if (slot >= GAME_SPRITE_CACHE_SLOTS) return NULL;
+    }
+    SpriteShadow *entry = &spriteShadow[slot];
+    entry->sprite = sprite;
+    entry->known = 0;
+    sprite->data = slot + 1;
+    return entry;
+}
+
+/** @brief Anota una llamada evitada o reenviada y devuelve si hay que reenviarla. */
+static u8 spriteCacheForward(u8 changed) {
+    if (changed) spriteCacheStats.forwarded++;
+    else spriteCacheStats.skipped++;
+    return changed;
+}
+
+void gameCore_sprSetPosition(Sprite *sprite, s16 x, s16 y) {
+    if (sprite == NULL) return;
+    SpriteShadow *entry = spriteShadowFor(sprite);
+    if (entry == NULL) {
+        SPR_setPosition(sprite, x, y);
+        return;
+    }
+    const u8 changed = !(entry->known & SHADOW_POSITION) || entry->x != x || entry->y != y;
+    if (!spriteCacheForward(changed)) return;
+    SPR_setPosition(sprite, x, y);
+    entry->x = x;
+    entry->y = y;
+    entry->known |= SHADOW_POSITION;
+}
+
+void gameCore_sprSetVisibility(Sprite *sprite, SpriteVisibility value) {
+    if (sprite == NULL) return;
+    SpriteShadow *entry = spriteShadowFor(sprite);
+    if (entry == NULL) {
+        SPR_setVisibility(sprite, value);
+        return;
+    }
+    const u8 changed = !(entry->known & SHADOW_VISIBILITY) || entry->visibility != (u8)value;
+    if (!spriteCacheForward(changed)) return;
+    SPR_setVisibility(sprite, value);
+    entry->visibility = (u8)value;
+    entry->known |= SHADOW_VISIBILITY;
+}
+
+void gameCore_sprSetDepth(Sprite *sprite, s16 depth) {
+    if (sprite == NULL) return;
+    SpriteShadow *entry = spriteShadowFor(sprite);
+    if (entry == NULL) {
+        SPR_setDepth(sprite, depth);
+        return;
+    }
+    const u8 changed = !(entry->known & SHADOW_DEPTH) || entry->depth != depth;
+    if (!spriteCacheForward(changed)) return;
+    SPR_setDepth(sprite, depth);
+    entry->depth = depth;
+    entry->known |= SHADOW_DEPTH;
+}
+
+void gameCore_sprSetHFlip(Sprite *sprite, bool value) {
+    if (sprite == NULL) return;
+    SpriteShadow *entry = spriteShadowFor(sprite);
+    if (entry == NULL) {
+        SPR_setHFlip(sprite, value);
+        return;
+    }
+    const u8 flip = value ? TRUE : FALSE;
+    const u8 changed = !(entry->known & SHADOW_HFLIP) || entry->hflip != flip;
+    if (!spriteCacheForward(changed)) return;
+    SPR_setHFlip(sprite, flip);
+    entry->hflip = flip;
+    entry->known |= SHADOW_HFLIP;
+}
+
+void gameCore_sprSetAnim(Sprite *sprite, s16 anim) {
+    if (sprite == NULL) return;
+    if (!spriteCacheForward(sprite->animInd != anim)) return;
+    SPR_setAnim(sprite, anim);
+}
+
+void gameCore_sprSetFrame(Sprite *sprite, s16 frame) {
+    if (sprite == NULL) return;
+    if (!spriteCacheForward(sprite->frameInd != frame)) return;
+    SPR_setFrame(sprite, frame);
+}
+
+void gameCore_sprRelease(Sprite *sprite) {
+    if (sprite == NULL) return;
+    const u32 handle = sprite->data;
+    if (handle > 0 && handle <= GAME_SPRITE_CACHE_SLOTS && spriteShadow[handle - 1].sprite == sprite) {
+        spriteShadow[handle - 1].sprite = NULL;
+    }
+    sprite->data = 0;
+    SPR_releaseSprite(sprite);
+}
+
+void gameCore_sprCacheReset(void) {
+    memset(spriteShadow, 0, sizeof(spriteShadow));
+    spriteShadowUsed = 0;
+}
+
+const GameSpriteCacheStats* gameCore_getSpriteCacheStats(void) {
+    return &spriteCacheStats;
+}
+
+void gameCore_resetSpriteCacheStats(void) {
+    spriteCacheStats.forwarded = 0;
+    spriteCacheStats.skipped = 0;
+}
+
+/** @brief Marca en líneas: frames de vtimer más el contador V ajustado. */
+u32 gameCore_getLineStamp(void) {
+    u32 frame;
+    u16 line;
+    /* Relee si la VInt cae entre las dos lecturas o si el haz está justo en su
+     * línea (vtimer puede no haber subido aún). */
+    do {
+        frame = vtimer;
+        line = VDP_getAdjustedVCounter();
+    } while (frame != vtimer || line == GAME_VINT_LINE);
+
+    /* Pasada la VInt vtimer ya cuenta el frame siguiente, pero estas líneas de
+     * VBlank son aún del frame que termina. */
+    if (line > GAME_VINT_LINE) frame--;
+    return (frame * GAME_FRAME_LINES) + line;
+}
+
+/**
+ * @brief Acumula un coste medido en la ranura indicada.
+ * @param stats Ranura a actualizar.
+ * @param lines Coste del frame en líneas.
+ * @param overrun TRUE si se perdió un VBlank.
+ */
+static void recordFrameCost(GameFrameStats *stats, u16 lines, u8 overrun) {
+    if (stats->frames == 0 || lines < stats->minLines) stats->minLines = lines;
+    if (lines > stats->maxLines) stats->maxLines = lines;
+    stats->totalLines += lines;
+    if (stats->frames < 0xFFFF) stats->frames++;
+    if (overrun && stats->overruns < 0xFFFF) stats->overruns++;
+}
+
+/**
+ * @brief Bucle común de fase: update medido, render y un único VBlank.
+ * @param statsSlot Ranura de estadísticas a rellenar.
+ * @param update Lógica de la fase.
+ * @param render Preparación de sprites de la fase.
+ * @param isComplete Condición de fin de fase.
+ */
+void gameCore_runPhaseLoop(u8 statsSlot, GamePhaseStepCallback *update,
+    GamePhaseStepCallback *render, GamePhaseDoneCallback *isComplete) {
+    if (update == NULL || isComplete == NULL) return;
+
+    GameFrameStats *stats = (statsSlot < GAME_FRAME_STATS_SLOTS) ? &frameStats[statsSlot] : NULL;
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(GameFrameStats));
+    }
+
+    while (!isComplete()) {
+        const u32 frameStart = vtimer;
+        const u32 start = gameCore_getLineStamp();
+        update();
+        const u32 cost = gameCore_getLineStamp() - start;
+        lastFrameCost = (cost > 0xFFFF) ? 0xFFFF : (u16)cost;
+
+        if (render != NULL) {
+            render();
+        }
+        const u32 frameCost = gameCore_getLineStamp() - start;
+        const u8 overrun = (vtimer != frameStart);
+        gameCore_qualityFeed((frameCost > 0xFFFF) ? 0xFFFF : (u16)frameCost, overrun);
+        if (stats != NULL) {
+            recordFrameCost(stats, lastFrameCost, overrun);
+            const u8 shed = gameCore_qualityGetShedCount();
+            if (shed > stats->qualityShedPeak) stats->qualityShedPeak = shed;
+        }
+        gameCore_waitVBlank();
+    }
+
+    if (stats != NULL) {
+        stats->vramPeak = gameCore_vramGetHighWater();
+    }
+#if GAME_PROFILE
+    gameCore_vramReport();
+#endif
+}
+
+/** @brief Devuelve las estadísticas de la ranura o NULL si no existe. */
+const GameFrameStats* gameCore_getFrameStats(u8 statsSlot) {
+    if (statsSlot >= GAME_FRAME_STATS_SLOTS) return NULL;
+    return &frameStats[statsSlot];
+}
+
+/** @brief Coste medio de update en líneas para la ranura indicada. */
+u16 gameCore_getFrameStatsAverage(u8 statsSlot) {
+    const GameFrameStats *stats = gameCore_getFrameStats(statsSlot);
+    if (stats == NULL || stats->frames == 0) return 0;
+    return (u16)(stats->totalLines / stats->frames);
+}
+
+/** @brief Coste en líneas del último update medido por el planificador. */
+u16 gameCore_getLastFrameCost(void) {
+    return lastFrameCost;
+}
+
+/* Gobernador de calidad: los primeros qualityShed efectos registrados están recortados. */
+static const char *qualityNames[GAME_QUALITY_MAX_EFFECTS]; /**< Nombres para trazas. */
+static u8 qualityIntervals[GAME_QUALITY_MAX_EFFECTS];      /**< Frecuencia reducida de cada efecto. */
+static u8 qualityCount = 0;        /**< Efectos registrados. */
+static u8 qualityShed = 0;         /**< Efectos recortados (prefijo de la lista). */
+static u8 qualityHotFrames = 0;    /**< Frames caros seguidos. */
+static u8 qualityCoolFrames = 0;   /**< Frames con holgura seguidos. */
+static u16 qualityFrame = 0;       /**< Frames alimentados, para las frecuencias reducidas. */
+
+/** @brief Añade un efecto opcional al final de la lista de recorte. */
+u8 gameCore_qualityRegister(const char *name, u8 shedInterval) {
+    if (qualityCount >= GAME_QUALITY_MAX_EFFECTS) {
+        GAME_PROF_LOG("Calidad: sin hueco para '%s'", name);
+        return GAME_QUALITY_NONE;
+    }
+    qualityNames[qualityCount] = name;
+    qualityIntervals[qualityCount] = shedInterval;
+    return qualityCount++;
+}
+
+/** @brief TRUE si el efecto está activo o le toca su frame reducido. */
+u8 gameCore_qualityShouldRun(u8 effect) {
+    if (effect >= qualityShed) return TRUE;
+    const u8 interval = qualityIntervals[effect];
+    return (interval != 0) && ((qualityFrame % interval) == 0);
+}
+
+/** @brief Recorta o restaura un nivel según el coste del frame (con histéresis). */
+void gameCore_qualityFeed(u16 lines, u8 overrun) {
+    qualityFrame++;
+    /* Sin VBlank perdido no cabe un frame entero de coste: es una lectura
+     * imposible, no carga, y no debe recortar nada. */
+    if (!overrun && lines >= GAME_FRAME_LINES) return;
+    if (overrun || lines > GAME_QUALITY_SHED_LINES) {
+        qualityCoolFrames = 0;
+        if (qualityHotFrames < 0xFF) qualityHotFrames++;
+        if ((overrun || qualityHotFrames >= GAME_QUALITY_SHED_FRAMES) && qualityShed < qualityCount) {
+            GAME_PROF_LOG("Calidad: recorta '%s' (%u lineas)", qualityNames[qualityShed], lines);
+            qualityShed++;
+            qualityHotFrames = 0;
+        }
+        return;
+    }
+
+    qualityHotFrames = 0;
+    if (lines >= GAME_QUALITY_RESTORE_LINES || qualityShed == 0) {
+        qualityCoolFrames = 0;
+        return;
+    }
+    if (++qualityCoolFrames >= GAME_QUALITY_RESTORE_FRAMES) {
+        qualityShed--;
+        qualityCoolFrames = 0;
+        GAME_PROF_LOG("Calidad: restaura '%s'", qualityNames[qualityShed]);
+    }
+}
+
+/** @brief Efectos recortados ahora mismo. */
+u8 gameCore_qualityGetShedCount(void) {
+    return qualityShed;
+}
+
+/** @brief Vacía la lista de efectos y vuelve a calidad completa. */
+void gameCore_qualityReset(void) {
+    qualityCount = 0;
+    qualityShed = 0;
+    qualityHotFrames = 0;
+    qualityCoolFrames = 0;
+    qualityFrame = 0;
+}
+
+#if GAME_PROFILE
+static u16 profCounts[GAME_PROF_COUNTERS]; /**< Llamadas del frame en curso. */
+static GameProfSnapshot profSnapshot;      /**< Último frame cerrado y picos. */
+static u32 profFrameStart = 0;   /**< Marca de línea al volver del último VBlank. */
+static u16 profDumpFrames = 0;   /**< Frames desde el último volcado. */
+static u8 profOverlay = FALSE;   /**< Overlay visible en BG_A. */
+static u8 profOverlayTimer = 0;  /**< Frames desde el último refresco del overlay. */
+static u8 profComboHeld = FALSE; /**< El combo ya estaba pulsado el frame anterior. */
+
+/** @brief Suma una llamada al contador indicado. */
+void gameCore_profCount(GameProfCounter counter) {
+    if (profCounts[counter] < 0xFFFF) profCounts[counter]++;
+}
+
+/** @brief Pinta dos filas compactas con el último frame en el plano WINDOW. */
+static void profDrawOverlay(void) {
+    char buffer[41];
+    sprintf(buffer, "SPR%3u COL%3u PCM%2u MAP%2u",
+        profSnapshot.last[GAME_PROF_SPR_SET_POSITION], profSnapshot.last[GAME_PROF_CHECK_COLLISION],
+        profSnapshot.last[GAME_PROF_PLAY_PCM], profSnapshot.last[GAME_PROF_MAP_SCROLL]);
+    VDP_drawTextBG(WINDOW, buffer, 1, 0);
+    sprintf(buffer, "SPRITES%3u/%3u LINEAS%3u/%3u",
+        profSnapshot.sprites, profSnapshot.spritesPeak, profSnapshot.lines, profSnapshot.linesPeak);
+    VDP_drawTextBG(WINDOW, buffer, 1, 1);
+}
+
+/**
+ * @brief Muestra u oculta el overlay.
+ *
+ * Va en el plano WINDOW, que no se desplaza: BG_A puede estar ocupado por la
+ * nieve con scroll, y así el texto ni se mueve con ella ni borra sus tiles.
+ */
+void gameCore_profSetOverlay(u8 enabled) {
+    profOverlay = enabled;
+    profOverlayTimer = 0;
+    for (u8 row = 0; row < GAME_PROF_OVERLAY_ROWS; row++) {
+        VDP_clearTextBG(WINDOW, 0, row, 40);
+    }
+    VDP_setWindowVPos(FALSE, enabled ? GAME_PROF_OVERLAY_ROWS : 0);
+}
+
+/** @brief Vuelca el último frame y los picos por KDebug. */
+static void profDump(void) {
+    kprintf("Prof: spr %u/%u col %u/%u pcm %u/%u map %u/%u sprites %u/%u lineas %u/%u",
+        profSnapshot.last[GAME_PROF_SPR_SET_POSITION], profSnapshot.peak[GAME_PROF_SPR_SET_POSITION],
+        profSnapshot.last[GAME_PROF_CHECK_COLLISION], profSnapshot.peak[GAME_PROF_CHECK_COLLISION],
+        profSnapshot.last[GAME_PROF_PLAY_PCM], profSnapshot.peak[GAME_PROF_PLAY_PCM],
+        profSnapshot.last[GAME_PROF_MAP_SCROLL], profSnapshot.peak[GAME_PROF_MAP_SCROLL],
+        profSnapshot.sprites, profSnapshot.spritesPeak, profSnapshot.lines, profSnapshot.linesPeak);
+}
+
+/** @brief Abre el frame de instrumentación. */
+void gameCore_profBeginFrame(void) {
+    profFrameStart = gameCore_getLineStamp();
+}
+
+/** @brief Cierra el frame de instrumentación. */
+void gameCore_profEndFrame(void) {
+    const u32 lines = gameCore_getLineStamp() - profFrameStart;
+
+    profSnapshot.lines = (lines > 0xFFFF) ? 0xFFFF : (u16)lines;
+    if (profSnapshot.lines > profSnapshot.linesPeak) profSnapshot.linesPeak = profSnapshot.lines;
+    profSnapshot.sprites = SPR_getNumActiveSprite();
+    if (profSnapshot.sprites > profSnapshot.spritesPeak) profSnapshot.spritesPeak = profSnapshot.sprites;
+    for (u8 i = 0; i < GAME_PROF_COUNTERS; i++) {
+        profSnapshot.last[i] = profCounts[i];
+        if (profCounts[i] > profSnapshot.peak[i]) profSnapshot.peak[i] = profCounts[i];
+        profCounts[i] = 0;
+    }
+
+    /* Mando en crudo: gameCore_readInput grabaría o consumiría frames de repetición
+     * que la versión release no tiene. */
+    const u8 comboHeld = ((JOY_readJoypad(JOY_1) & GAME_PROF_OVERLAY_COMBO) == GAME_PROF_OVERLAY_COMBO);
+    if (comboHeld && !profComboHeld) {
+        gameCore_profSetOverlay(!profOverlay);
+    }
+    profComboHeld = comboHeld;
+
+    if (profOverlay && ++profOverlayTimer >= GAME_PROF_OVERLAY_FRAMES) {
+        profOverlayTimer = 0;
+        profDrawOverlay();
+    }
+
+    if (++profDumpFrames >= GAME_PROF_DUMP_FRAMES) {
+        profDumpFrames = 0;
+        profDump();
+        memset(profSnapshot.peak, 0, sizeof(profSnapshot.peak));
+        profSnapshot.spritesPeak = 0;
+        profSnapshot.linesPeak = 0;
+    }
+}
+
+/** @brief Último frame cerrado y picos acumulados. */
+const GameProfSnapshot* gameCore_profGetSnapshot(void) {
+    return &profSnapshot;
+}
+#endif
@@ -0,0 +1,53 @@
+/* Generado por tools/gen_luts.py: no editar a mano. */
+/**
+ * @file game_luts.c
+ * @brief Datos de las tablas precalculadas (ver game_luts.h).
+ */
+
+#include "game_luts.h"
+
+const u16 gameLut_recip[GAME_LUT_RECIP_SIZE] = {
+    0, 32768, 16384, 10923, 8192, 6554, 5462, 4682, 4096, 3641, 3277, 2979, 2731, 2521, 2341, 2185,
+    2048, 1928, 1821, 1725, 1639, 1561, 1490, 1425, 1366, 1311, 1261, 1214, 1171, 1130, 1093, 1058,
+    1024, 993, 964, 937, 911, 886, 863, 841, 820, 800, 781, 763, 745, 729, 713, 698,
+    683, 669, 656, 643, 631, 619, 607, 596, 586, 575, 565, 556, 547, 538, 529, 521,
+    512, 505, 497, 490, 482, 475, 469, 462, 456, 449, 443, 437, 432, 426, 421, 415,
+    410, 405, 400, 395, 391, 386, 382, 377, 373, 369, 365, 361, 357, 353, 349, 345,
+    342, 338, 335, 331, 328, 325, 322, 319, 316, 313, 310, 307, 304, 301, 298, 296,
+    293, 290, 288, 285, 283, 281, 278, 276, 274, 271, 269, 267, 265, 263, 261, 259,
+    256, 255, 253, 251, 249, 247, 245, 243, 241, 240, 238, 236, 235, 233, 231, 230,
+    228, 226, 225, 223, 222, 220, 219, 218, 216, 215, 213, 212, 211, 209, 208, 207,
+    205, 204, 203, 202, 200, 199, 198, 197, 196, 194, 193, 192, 191, 190, 189, 188,
+    187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173, 172,
+    171, 170, 169, 169, 168, 167, 166, 165, 164, 164, 163, 162, 161, 160, 160, 159,
+    158, 157, 157, 156, 155, 154, 154, 153, 152, 152, 151, 150, 149, 149, 148, 147,
+    147, 146, 145, 145, 144, 144, 143, 142, 142, 141, 141, 140, 139, 139, 138, 138,
+    137, 136, 136, 135, 135, 134, 134, 133, 133, 132, 132, 131, 131, 130, 130, 129,
+};
+
+const u8 gameLut_arc[GAME_LUT_ARC_STEPS] = {
+    0, 4, 8, 11, 15, 18, 22, 25, 28, 31, 34, 36, 39, 41, 44, 46,
+    48, 50, 52, 53, 55, 56, 58, 59, 60, 61, 62, 62, 63, 63, 64, 64,
+    64, 64, 64, 63, 63, 62, 62, 61, 60, 59, 58, 56, 55, 53, 52, 50,
+    48, 46, 44, 41, 39, 36, 34, 31, 28, 25, 22, 18, 15, 11, 8, 4,
+    0,
+};
+
+const s8 gameLut_sway[GAME_LUT_SWAY_STEPS] = {
+    0, 2, 3, 5, 6, 8, 9, 11, 12, 14, 16, 17, 19, 20, 22, 23,
+    24, 26, 27, 29, 30, 32, 33, 34, 36, 37, 38, 39, 41, 42, 43, 44,
+    45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 56, 57, 58, 59,
+    59, 60, 60, 61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 63, 63, 63, 62, 62, 62, 61, 61, 60, 60,
+    59, 59, 58, 57, 56, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46,
+    45, 44, 43, 42, 41, 39, 38, 37, 36, 34, 33, 32, 30, 29, 27, 26,
+    24, 23, 22, 20, 19, 17, 16, 14, 12, 11, 9, 8, 6, 5, 3, 2,
+    0, -2, -3, -5, -6, -8, -9, -11, -12, -14, -16, -17, -19, -20, -22, -23,
+    -24, -26, -27, -29, -30, -32, -33, -34, -36, -37, -38, -39, -41, -42, -43, -44,
+    -45, -46, -47, -48, -49, -50, -51, -52, -53, -54, -55, -56, -56, -57, -58, -59,
+    -59, -60, -60, -61, -61, -62, -62, -62, -63, -63, -63, -64, -64, -64, -64, -64,
+    -64, -64, -64, -64, -64, -64, -63, -63, -63, -62, -62, -62, -61, -61, -60, -60,
+    -59, -59, -58, -57, -56, -56, -55, -54, -53, -52, -51, -50, -49, -48, -47, -46,
+    -45, -44, -43, -42, -41, -39, -38, -37, -36, -34, -33, -32, -30, -29, -27, -26,
+    -24, -23, -22, -20, -19, -17, -16, -14, -12, -11, -9, -8, -6, -5, -3, -2,
+};
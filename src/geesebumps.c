@@ -21,6 +21,19 @@
 
 static bool should_exit = false; /**< Señal para abandonar la intro al pulsar. */
 
+/**
+ * @brief Estado de la animación del logo que cruza frames de la tarea.
+ */
+typedef struct {
+    Sprite *text;    /**< Texto "Geesebumps". */
+    Sprite *lines1;  /**< Primer grupo de líneas. */
+    Sprite *lines2;  /**< Segundo grupo de líneas. */
+    u16 difx;        /**< Desplazamiento restante de las líneas. */
+    u16 pause;       /**< Frames de pausa transcurridos. */
+} LogoState;
+
+static u8 logoTask(GameTask *task);
+
 /**
  * @brief Manejador de eventos de joystick durante la pantalla de logo.
  *
@@ -42,11 +55,12 @@ static void joyEvent_Geesebumps(u16 joy, u16 changed, u16 state)
  */
 void geesebumps_logo(void)
 {
-    Sprite *logo_text, *logo_lines1, *logo_lines2; /**< Sprites del logo. */
+    static LogoState state; /**< Sprites y contadores de la animación. */
+    static GameTask task;   /**< Tarea que anima el logo. */
     should_exit = false; /**< Reinicia la bandera de salida temprana. */
 
-    gameCore_resetVideoState(); /**< Garantiza VRAM limpia y reinicia tile index. */
-    int indice_tiles = TILE_USER_INDEX; /**< Primer tile libre para cargar BG. */
+    gameCore_resetVideoState(); /**< Garantiza VRAM limpia y libera las regiones de tiles. */
+    const u16 indice_tiles = gameCore_vramAlloc("geesebumps_logo", geesebumps_logo_bg.tileset->numTile); /**< Tiles del BG. */
     
     /* Configura el manejador de joystick */
     JOY_setEventHandler(&joyEvent_Geesebumps);
@@ -62,65 +76,75 @@ void geesebumps_logo(void)
     
     /* Primera parte del logo (Goose) */
     VDP_drawImageEx(BG_A, &geesebumps_logo_bg, TILE_ATTR_FULL(PAL0, false, false, false, indice_tiles), 0, 0, false, true);
-    indice_tiles+=geesebumps_logo_bg.tileset->numTile;
 
     /* Cargar el resto de sprites */
-    logo_text = SPR_addSpriteSafe(&geesebumps_logo_text, 60, 163, TILE_ATTR(PAL1, false, false, false));
-    logo_lines1 = SPR_addSpriteSafe(&geesebumps_logo_line1, 81-180, 55, TILE_ATTR(PAL2, false, false, false));
-    logo_lines2 = SPR_addSpriteSafe(&geesebumps_logo_line2, 81-180, 84, TILE_ATTR(PAL3, false, false, false));
-    SPR_setVisibility(logo_text, HIDDEN);
+    state.text = SPR_addSpriteSafe(&geesebumps_logo_text, 60, 163, TILE_ATTR(PAL1, false, false, false));
+    state.lines1 = SPR_addSpriteSafe(&geesebumps_logo_line1, 81-180, 55, TILE_ATTR(PAL2, false, false, false));
+    state.lines2 = SPR_addSpriteSafe(&geesebumps_logo_line2, 81-180, 84, TILE_ATTR(PAL3, false, false, false));
+    SPR_setVisibility(state.text, HIDDEN);
     SPR_update();
 
+    gameCore_taskRun(&task, logoTask, &state);
+
+    /* Liberar recursos */
+    JOY_setEventHandler(NULL);
+    VDP_releaseAllSprites();
+    SPR_reset();
+    VDP_clearPlane(BG_A, true);
+    PAL_setPalette(PAL0, geesebumps_pal_black.data, DMA);
+    PAL_setPalette(PAL1, geesebumps_pal_black.data, DMA);
+    PAL_setPalette(PAL2, geesebumps_pal_black.data, DMA);
+    PAL_setPalette(PAL3, geesebumps_pal_black.data, DMA);
+    gameCore_vramFree(indice_tiles);
+}
+
+/**
+ * @brief Fundidos, scroll de líneas, pausa y fade out del logo como tarea.
+ *
+ * Cada espera cede el frame en lugar de bloquear, así que otras tareas
+ * (cargas, audio) pueden avanzar mientras se muestra el logo.
+ */
+static u8 logoTask(GameTask *task) {
+    LogoState *state = (LogoState*)task->data;
+
+    GAME_TASK_BEGIN(task);
+
     /* Segunda parte (texto) con fade in */
     if (!should_exit) {
-        PAL_fade(0, 15, geesebumps_pal_black.data, geesebumps_logo_bg.palette->data, SCREEN_FPS*2, true);
-                
-        while (PAL_isDoingFade() && !should_exit) {
-            SYS_doVBlankProcess();
-        }
+        gameCore_startPaletteFade(0, 15, geesebumps_logo_bg.palette->data, SCREEN_FPS*2);
+        GAME_TASK_WAIT_UNTIL(task, !gameCore_isFading() || should_exit);
         PAL_setPalette(PAL0, geesebumps_logo_bg.palette->data, DMA);
-        SYS_doVBlankProcess();
+        GAME_TASK_YIELD(task);
 
         if (!should_exit) {
-            SPR_setVisibility(logo_text, VISIBLE);
+            SPR_setVisibility(state->text, VISIBLE);
             SPR_update();
-            
-            PAL_fade(16, 31, geesebumps_pal_white.data, geesebumps_logo_text.palette->data, SCREEN_FPS*2, true);
-            
-            while (PAL_isDoingFade() && !should_exit) {
-                SYS_doVBlankProcess();
-            }
+
+            gameCore_startPaletteFade(16, 31, geesebumps_logo_text.palette->data, SCREEN_FPS*2);
+            GAME_TASK_WAIT_UNTIL(task, !gameCore_isFading() || should_exit);
             PAL_setPalette(PAL1, geesebumps_logo_text.palette->data, DMA);
-            SYS_doVBlankProcess();
+            GAME_TASK_YIELD(task);
         }
     }
 
     /* Tercera y cuarta parte (líneas) con fade y scroll */
     if (!should_exit) {
         PAL_initFade(32, 63, geesebumps_pal_white2.data, geesebumps_pal_lines.data, SCREEN_FPS*3);
-        for (u16 difx=180; difx>0 && !should_exit; difx--) {
-            SPR_setPosition(logo_lines1, 81-difx, 55);
-            SPR_setPosition(logo_lines2, 81-difx, 84);
+        for (state->difx = 180; state->difx > 0 && !should_exit; state->difx--) {
+            SPR_setPosition(state->lines1, 81 - state->difx, 55);
+            SPR_setPosition(state->lines2, 81 - state->difx, 84);
             SPR_update();
             PAL_doFadeStep();
-            SYS_doVBlankProcess();
+            GAME_TASK_YIELD(task);
         }
     }
 
-    /* Pausa y fade out */
-    if (!should_exit) waitMs(3000);
-    PAL_fadeOutAll(SCREEN_FPS*2,false);
-    XGM2_fadeOut(SCREEN_FPS*2);
-    waitMs(2000);
+    /* Pausa (se puede saltar) y fade out de paletas y música a la vez */
+    for (state->pause = 0; state->pause < SCREEN_FPS*3 && !should_exit; state->pause++) {
+        GAME_TASK_YIELD(task);
+    }
+    gameCore_startFadeOut(SCREEN_FPS*2, TRUE);
+    GAME_TASK_WAIT_UNTIL(task, !gameCore_isFading());
 
-    /* Liberar recursos */
-    JOY_setEventHandler(NULL);
-    VDP_releaseAllSprites();
-    SPR_reset();
-    VDP_clearPlane(BG_A, true);
-    PAL_setPalette(PAL0, geesebumps_pal_black.data, DMA);
-    PAL_setPalette(PAL1, geesebumps_pal_black.data, DMA);
-    PAL_setPalette(PAL2, geesebumps_pal_black.data, DMA);
-    PAL_setPalette(PAL3, geesebumps_pal_black.data, DMA);
-    indice_tiles-=geesebumps_logo_bg.tileset->numTile;   
+    GAME_TASK_END(task);
 }
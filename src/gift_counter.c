@@ -1,4 +1,5 @@
 #include "gift_counter.h"
+#include "game_core.h"
 
 void giftCounter_initHUD(GiftCounterHUD* hud, Sprite* top, Sprite* bottom,
     s16 baseX, s16 baseY, s16 topOffsetY, s16 bottomOffsetX,
@@ -60,18 +61,18 @@ void giftCounter_render(const GiftCounterHUD* hud, u16 value) {
     }
 
     if (hud->top) {
-        SPR_setAnim(hud->top, 0);
-        SPR_setFrame(hud->top, topFrame);
-        SPR_setPosition(hud->top, hud->baseX, hud->baseY + hud->topOffsetY);
-        SPR_setDepth(hud->top, hud->depthTop);
-        SPR_setVisibility(hud->top, VISIBLE);
+        gameCore_sprSetAnim(hud->top, 0);
+        gameCore_sprSetFrame(hud->top, topFrame);
+        gameCore_sprSetPosition(hud->top, hud->baseX, hud->baseY + hud->topOffsetY);
+        gameCore_sprSetDepth(hud->top, hud->depthTop);
+        gameCore_sprSetVisibility(hud->top, VISIBLE);
     }
 
     if (hud->bottom) {
-        SPR_setAnim(hud->bottom, 0);
-        SPR_setFrame(hud->bottom, bottomFrame);
-        SPR_setPosition(hud->bottom, hud->baseX + hud->bottomOffsetX, hud->baseY);
-        SPR_setDepth(hud->bottom, hud->depthBottom);
-        SPR_setVisibility(hud->bottom, VISIBLE);
+        gameCore_sprSetAnim(hud->bottom, 0);
+        gameCore_sprSetFrame(hud->bottom, bottomFrame);
+        gameCore_sprSetPosition(hud->bottom, hud->baseX + hud->bottomOffsetX, hud->baseY);
+        gameCore_sprSetDepth(hud->bottom, hud->depthBottom);
+        gameCore_sprSetVisibility(hud->bottom, VISIBLE);
     }
 }
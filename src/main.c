@@ -49,6 +49,10 @@ enum {
     PHASE_END = 6
 };
 
+/* Captura de entrada: 0 = normal, 1 = grabar partida en SRAM, 2 = reproducir partida de SRAM */
+#define INPUT_CAPTURE_MODE 0
+#define INPUT_CAPTURE_SEED 0x2026 /* Semilla fija para que la grabación sea repetible. */
+
 /* Variables globales */
 static u8 currentPhase = PHASE_INTRO; /**< Fase actual del bucle principal. */
 static u32 phaseTimerStart = 0;       /**< Tiempo de inicio de la fase en unidades de 1/256s. */
@@ -91,6 +95,61 @@ static void drawPhaseDurations(u16 startY) {
     VDP_drawText(buffer, 8, startY + 5);
 }
 
+/**
+ * @brief Arranca la grabación o reproducción de entrada según INPUT_CAPTURE_MODE.
+ */
+static void startInputCapture(void) {
+#if (INPUT_CAPTURE_MODE == 1)
+    gameCore_startInputRecording(INPUT_CAPTURE_SEED);
+#elif (INPUT_CAPTURE_MODE == 2)
+    if (!gameCore_loadInputRecording() || !gameCore_startInputReplay()) {
+        kprintf("Input: no hay grabacion valida en SRAM");
+    }
+#endif
+}
+
+/**
+ * @brief Cierra la captura de entrada; al grabar, vuelca la partida a SRAM.
+ */
+static void finishInputCapture(void) {
+#if (INPUT_CAPTURE_MODE == 1)
+    gameCore_saveInputRecording();
+    kprintf("Input: grabados %u tramos", gameCore_getInputRunCount());
+#endif
+#if (INPUT_CAPTURE_MODE != 0)
+    if (gameCore_isInputTruncated()) {
+        kprintf("Input: captura TRUNCADA; la partida no es repetible entera");
+    }
+#endif
+    gameCore_stopInputCapture();
+}
+
+#if GAME_PROFILE
+/**
+ * @brief Muestra el coste de update por fase (media/máximo en líneas, frames perdidos, pico de VRAM y efectos recortados).
+ *
+ * Pantalla de desarrollo: solo se compila con GAME_PROFILE. SGDK no tiene
+ * snprintf, así que el buffer cabe la línea más ancha posible:
+ * "F4 65535/65535/65535 x65535 v65535 q255" (39 caracteres).
+ *
+ * @param startY Fila inicial en tiles.
+ */
+static void drawPhaseFrameStats(u16 startY) {
+    static const u8 phases[] = { PHASE_PICKUP, PHASE_DELIVERY, PHASE_BELLS, PHASE_CELEBRATION };
+    char buffer[40];
+
+    VDP_drawText("Coste update (lineas)", 7, startY);
+    for (u8 i = 0; i < sizeof(phases); i++) {
+        const GameFrameStats *stats = gameCore_getFrameStats(phases[i]);
+        if (stats == NULL) continue;
+        sprintf(buffer, "F%u %u/%u/%u x%u v%u q%u", i + 1,
+            stats->minLines, gameCore_getFrameStatsAverage(phases[i]),
+            stats->maxLines, stats->overruns, stats->vramPeak, stats->qualityShedPeak);
+        VDP_drawText(buffer, 1, startY + 2 + i);
+    }
+}
+#endif
+
 /**
  * @brief Punto de entrada principal del cartucho.
  *
@@ -120,65 +179,66 @@ int main() {
             case PHASE_TITLE:
                 /* Pantalla de titulo */
                 // Klog("Pantalla de titulo");
+                startInputCapture();
                 title_show();
+#if (INPUT_CAPTURE_MODE == 0)
+                /* Partida normal: la semilla sale del contador HV al elegir idioma. */
+                gameCore_seedRandom(random());
+#endif
                 currentPhase = PHASE_PICKUP;
                 break;
 
             case PHASE_PICKUP:
                 /* Fase 1: Recogida - Polo Norte */
                 // Klog("Fase 1: Recogida");
-                cutscene_phase1_intro();
+                cutscene_phase1_intro(minigamePickup_preload);
                 gameCore_fadeToBlack();
                 startPhaseTimer();
                 minigamePickup_init();
-                while (!minigamePickup_isComplete()) {
-                    minigamePickup_update();
-                    minigamePickup_render();
-                    JOY_readJoypad(JOY_1);
-                }
-                minigamePickup_shutdown();
+                gameCore_runPhaseLoop(PHASE_PICKUP, minigamePickup_update,
+                    minigamePickup_render, minigamePickup_isComplete);
                 stopPhaseTimer(PHASE_PICKUP);
-                gameCore_fadeToBlack();
+                gameCore_startFadeOut(GAME_FADE_FRAMES, TRUE);
+                minigamePickup_shutdown(); /* Se libera mientras avanza el fundido. */
+                gameCore_waitFade();
                 currentPhase = PHASE_DELIVERY;
                 break;
 
             case PHASE_DELIVERY:
                 /* Fase 2: Entrega - Tejados */
                 // Klog("Fase 2: Entrega");
-                cutscene_phase2_intro();
+                cutscene_phase2_intro(minigameDelivery_preload);
                 gameCore_fadeToBlack();
                 audio_play_phase2();
                 startPhaseTimer();
                 minigameDelivery_init();
-                while (!minigameDelivery_isComplete()) {
-                    minigameDelivery_update();
-                    minigameDelivery_render();
-                    JOY_readJoypad(JOY_1);
-                }
-                minigameDelivery_shutdown();
+                gameCore_runPhaseLoop(PHASE_DELIVERY, minigameDelivery_update,
+                    minigameDelivery_render, minigameDelivery_isComplete);
                 stopPhaseTimer(PHASE_DELIVERY);
-                gameCore_fadeToBlack();
+                gameCore_startFadeOut(GAME_FADE_FRAMES, TRUE);
+                minigameDelivery_shutdown(); /* Se libera mientras avanza el fundido. */
+                gameCore_waitFade();
                 currentPhase = PHASE_BELLS;
                 break;
 
             case PHASE_BELLS:
                 /* Fase 3: Campanadas - IMPLEMENTADA */
                 // Klog("Fase 3: Campanadas");
-                cutscene_phase3_intro();
+                cutscene_phase3_intro(minigameBells_preload);
                 gameCore_fadeToBlack();
                 startPhaseTimer();
                 minigameBells_init();
-                while (!minigameBells_isComplete()) {
-                    minigameBells_update();
-                    minigameBells_render();
-                }
-                minigameBells_shutdown();
+                gameCore_runPhaseLoop(PHASE_BELLS, minigameBells_update,
+                    minigameBells_render, minigameBells_isComplete);
                 stopPhaseTimer(PHASE_BELLS);
+                gameCore_startFadeOut(GAME_FADE_FRAMES, TRUE);
+                minigameBells_shutdown(); /* Se libera mientras avanza el fundido. */
+                finishInputCapture();
                 minigameCelebration_setTimes(
                     phaseDurationsSeconds[PHASE_PICKUP],
                     phaseDurationsSeconds[PHASE_DELIVERY],
                     phaseDurationsSeconds[PHASE_BELLS]);
-                gameCore_fadeToBlack();
+                gameCore_waitFade();
                 currentPhase = PHASE_CELEBRATION;
                 break;
 
@@ -188,14 +248,12 @@ int main() {
                 audio_play_phase4();
                 startPhaseTimer();
                 minigameCelebration_init();
-                while (!minigameCelebration_isComplete()) {
-                    minigameCelebration_update();
-                    minigameCelebration_render();
-                    JOY_readJoypad(JOY_1);
-                }
-                minigameCelebration_shutdown();
+                gameCore_runPhaseLoop(PHASE_CELEBRATION, minigameCelebration_update,
+                    minigameCelebration_render, minigameCelebration_isComplete);
                 stopPhaseTimer(PHASE_CELEBRATION);
-                gameCore_fadeToBlack();
+                gameCore_startFadeOut(GAME_FADE_FRAMES, TRUE);
+                minigameCelebration_shutdown(); /* Se libera mientras avanza el fundido. */
+                gameCore_waitFade();
                 currentPhase = PHASE_END;
                 break;
 
@@ -208,8 +266,13 @@ int main() {
                 VDP_drawText("!FELIZ 2026!", 10, 10);
                 VDP_drawText("Proyecto Navidad Mega Drive", 5, 14);
                 drawPhaseDurations(16);
+#if GAME_PROFILE
+                drawPhaseFrameStats(22);
+#endif
                 SYS_doVBlankProcess();
-                JOY_waitPress(JOY_ALL, BUTTON_ALL);
+                while ((gameCore_readInput() & BUTTON_ALL) == 0) {
+                    SYS_doVBlankProcess();
+                }
                 return 0;
 
             default:
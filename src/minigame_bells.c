@@ -37,6 +37,10 @@
 #define LETTER_WIDTH 32                  /* Ancho de cada letra en píxeles. */
 #define LETTER_HEIGHT 32                 /* Alto de cada letra en píxeles. */
 #define LETTER_COLLISION_HEIGHT 20       /* Altura útil para colisiones de letra. */
+#define LAYER_BELL 0x01                  /* Capa de rejilla: campanas móviles. */
+#define LAYER_LETTER 0x02                /* Capa de rejilla: letras. */
+#define LAYER_BOMB 0x04                  /* Capa de rejilla: bombas. */
+#define GRID_MAX_HITS 4                  /* Impactos por bala (el centro es un punto). */
 
 enum {
     PHASE_BELLS = 0,
@@ -107,7 +111,17 @@ static s8 bulletCooldown; /**< Ventana de recarga del cañón. */
 static GameTimer gameTimer; /**< Temporizador para derrota por tiempo. */
 static Map *mapBackground; /**< Mapa de fondo asignado al plano B. */
 static SnowEffect snowEffect; /**< Partículas de nieve reutilizadas. */
+static u8 qualitySnow; /**< Efecto opcional: animación de la nieve. */
+static u8 qualityBlink; /**< Efecto opcional: parpadeo de marcador y mensaje. */
 static const GameInertia cannonInertia = { CANNON_ACCEL, CANNON_FRICTION, 1, CANNON_MAX_VEL }; /**< Configuración de inercia del cañón. */
+
+/** @brief Bandas de nieve: arriba lejos y lenta, abajo cerca y amplia. */
+static const SnowLayer snowLayers[] = {
+    { 8, 1, 16 },
+    { 10, 2, 40 },
+    { 10, 3, SNOW_SWAY_PX },
+};
+
 static const SpriteDefinition* const letterSpritesColor[NUM_LETTERS] = {
     &sprite_letra_f, &sprite_letra_e, &sprite_letra_l, &sprite_letra_i,
     &sprite_letra_z, &sprite_letra_2, &sprite_letra_0, &sprite_letra_6
@@ -122,6 +136,7 @@ static const SpriteDefinition* const felizSpritesBW[NUM_TARGET_LETTERS] = {
 }; /**< Variante monocroma del mensaje final. */
 
 static void detectarColisionesBala(Bullet* bala);
+static void registrarObjetivosEnRejilla(void);
 static void initLetter(Letter* letter, u8 index);
 static void resetLetter(Letter* letter);
 static void updateLetter(Letter* letter);
@@ -138,14 +153,14 @@ static void startLettersPhase(void);
  * @param index Índice para desfasar posición inicial.
  */
 static void initBell(Bell* bell, u8 index) {
-    s16 posX = random() % (SCREEN_WIDTH - 32);
+    s16 posX = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - 32);
 
     bell->sprite = SPR_addSpriteSafe(&sprite_campana, posX, -32,
         TILE_ATTR(PAL_ENEMY, FALSE, FALSE, FALSE));
 
     bell->x = posX;
-    bell->y = -32 - (random() % 100);
-    bell->velocity = (random() % 2) + 1;
+    bell->y = -32 - gameCore_randomRange(GAME_RNG_BELLS, 100);
+    bell->velocity = gameCore_randomRange(GAME_RNG_BELLS, 2) + 1;
     bell->blinkCounter = 0;
     bell->isBlinking = FALSE;
     (void)index;
@@ -153,12 +168,12 @@ static void initBell(Bell* bell, u8 index) {
 
 /** @brief Reinicia posición y estado de una campana móvil. */
 static void resetBell(Bell* bell) {
-    bell->x = random() % (SCREEN_WIDTH - 32);
-    bell->y = -32 - (random() % 100);
+    bell->x = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - 32);
+    bell->y = -32 - gameCore_randomRange(GAME_RNG_BELLS, 100);
     bell->isBlinking = FALSE;
     bell->blinkCounter = 0;
-    SPR_setVisibility(bell->sprite, VISIBLE);
-    SPR_setPosition(bell->sprite, bell->x, bell->y);
+    gameCore_sprSetVisibility(bell->sprite, VISIBLE);
+    gameCore_sprSetPosition(bell->sprite, bell->x, bell->y);
 }
 
 /**
@@ -173,15 +188,15 @@ static void updateBell(Bell* bell) {
 
     if (bell->isBlinking) {
         if (bell->blinkCounter % 2 == 0) {
-            SPR_setVisibility(bell->sprite, VISIBLE);
+            gameCore_sprSetVisibility(bell->sprite, VISIBLE);
         } else {
-            SPR_setVisibility(bell->sprite, HIDDEN);
+            gameCore_sprSetVisibility(bell->sprite, HIDDEN);
         }
 
         bell->blinkCounter--;
         if (bell->blinkCounter <= 0) {
             bell->isBlinking = FALSE;
-            SPR_setVisibility(bell->sprite, VISIBLE);
+            gameCore_sprSetVisibility(bell->sprite, VISIBLE);
             resetBell(bell);
         }
         return;
@@ -195,7 +210,7 @@ static void updateBell(Bell* bell) {
         resetBell(bell);
     }
 
-    SPR_setPosition(bell->sprite, bell->x, bell->y);
+    gameCore_sprSetPosition(bell->sprite, bell->x, bell->y);
 }
 
 /** @brief Crea el conjunto de campanas fijas del marcador inferior. */
@@ -232,14 +247,14 @@ static void updateFixedBells(void) {
  * @param index Índice para variar la posición inicial.
  */
 static void initBomb(Bomb* bomb, u8 index) {
-    s16 posX = random() % (SCREEN_WIDTH - 32);
+    s16 posX = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - 32);
 
     bomb->sprite = SPR_addSpriteSafe(&sprite_bomba, posX, -32,
         TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
 
     bomb->x = posX;
     bomb->y = -32;
-    bomb->velocity = (random() % 3) + 1;
+    bomb->velocity = gameCore_randomRange(GAME_RNG_BELLS, 3) + 1;
     bomb->blinkCounter = 0;
     bomb->isBlinking = FALSE;
     bomb->y -= (index * 8);
@@ -247,12 +262,12 @@ static void initBomb(Bomb* bomb, u8 index) {
 
 /** @brief Reinicia posición y estado de una bomba. */
 static void resetBomb(Bomb* bomb) {
-    bomb->x = random() % (SCREEN_WIDTH - 32);
+    bomb->x = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - 32);
     bomb->y = -32;
     bomb->isBlinking = FALSE;
     bomb->blinkCounter = 0;
-    SPR_setVisibility(bomb->sprite, VISIBLE);
-    SPR_setPosition(bomb->sprite, bomb->x, bomb->y);
+    gameCore_sprSetVisibility(bomb->sprite, VISIBLE);
+    gameCore_sprSetPosition(bomb->sprite, bomb->x, bomb->y);
 }
 
 /**
@@ -267,15 +282,15 @@ static void updateBomb(Bomb* bomb) {
 
     if (bomb->isBlinking) {
         if (bomb->blinkCounter % 2 == 0) {
-            SPR_setVisibility(bomb->sprite, VISIBLE);
+            gameCore_sprSetVisibility(bomb->sprite, VISIBLE);
         } else {
-            SPR_setVisibility(bomb->sprite, HIDDEN);
+            gameCore_sprSetVisibility(bomb->sprite, HIDDEN);
         }
 
         bomb->blinkCounter--;
         if (bomb->blinkCounter <= 0) {
             bomb->isBlinking = FALSE;
-            SPR_setVisibility(bomb->sprite, VISIBLE);
+            gameCore_sprSetVisibility(bomb->sprite, VISIBLE);
             resetBomb(bomb);
         }
         return;
@@ -289,7 +304,7 @@ static void updateBomb(Bomb* bomb) {
         resetBomb(bomb);
     }
 
-    SPR_setPosition(bomb->sprite, bomb->x, bomb->y);
+    gameCore_sprSetPosition(bomb->sprite, bomb->x, bomb->y);
 }
 
 /**
@@ -298,26 +313,26 @@ static void updateBomb(Bomb* bomb) {
  * @param index Índice para seleccionar sprite y variar posición.
  */
 static void initLetter(Letter* letter, u8 index) {
-    s16 posX = random() % (SCREEN_WIDTH - LETTER_WIDTH);
+    s16 posX = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - LETTER_WIDTH);
 
     letter->sprite = SPR_addSpriteSafe(letterSpritesColor[index], posX, -32,
         TILE_ATTR(PAL_ENEMY, FALSE, FALSE, FALSE));
 
     letter->x = posX;
-    letter->y = -32 - (random() % 100);
-    letter->velocity = (random() % 4) + 1;
+    letter->y = -32 - gameCore_randomRange(GAME_RNG_BELLS, 100);
+    letter->velocity = gameCore_randomRange(GAME_RNG_BELLS, 4) + 1;
     letter->blinkCounter = 0;
     letter->isBlinking = FALSE;
 }
 
 /** @brief Reinicia posición y estado de una letra. */
 static void resetLetter(Letter* letter) {
-    letter->x = random() % (SCREEN_WIDTH - LETTER_WIDTH);
-    letter->y = -32 - (random() % 100);
+    letter->x = gameCore_randomRange(GAME_RNG_BELLS, SCREEN_WIDTH - LETTER_WIDTH);
+    letter->y = -32 - gameCore_randomRange(GAME_RNG_BELLS, 100);
     letter->isBlinking = FALSE;
     letter->blinkCounter = 0;
-    SPR_setVisibility(letter->sprite, VISIBLE);
-    SPR_setPosition(letter->sprite, letter->x, letter->y);
+    gameCore_sprSetVisibility(letter->sprite, VISIBLE);
+    gameCore_sprSetPosition(letter->sprite, letter->x, letter->y);
 }
 
 /**
@@ -331,11 +346,11 @@ static void updateLetter(Letter* letter) {
     }
 
     if (letter->isBlinking) {
-        SPR_setVisibility(letter->sprite, (letter->blinkCounter % 2) ? HIDDEN : VISIBLE);
+        gameCore_sprSetVisibility(letter->sprite, (letter->blinkCounter % 2) ? HIDDEN : VISIBLE);
         letter->blinkCounter--;
         if (letter->blinkCounter <= 0) {
             letter->isBlinking = FALSE;
-            SPR_setVisibility(letter->sprite, VISIBLE);
+            gameCore_sprSetVisibility(letter->sprite, VISIBLE);
             resetLetter(letter);
         }
         return;
@@ -349,7 +364,7 @@ static void updateLetter(Letter* letter) {
         resetLetter(letter);
     }
 
-    SPR_setPosition(letter->sprite, letter->x, letter->y);
+    gameCore_sprSetPosition(letter->sprite, letter->x, letter->y);
 }
 
 /** @brief Inicializa el pool de balas disparables. */
@@ -388,12 +403,14 @@ static void fireBullet(void) {
 
 /** @brief Actualiza todas las balas activas, reciclándolas cuando salen de pantalla. */
 static void updateBullets(void) {
+    registrarObjetivosEnRejilla();
+
     for (u8 i = 0; i < NUM_BULLETS; i++) {
         if (bullets[i].active) {
             bullets[i].y -= BULLET_VELOCITY;
 
             if (bullets[i].y < -8) {
-                SPR_releaseSprite(bullets[i].sprite);
+                gameCore_sprRelease(bullets[i].sprite);
                 bullets[i].sprite = NULL;
                 bullets[i].active = FALSE;
                 activeBullets--;
@@ -403,7 +420,7 @@ static void updateBullets(void) {
             detectarColisionesBala(&bullets[i]);
 
             if (bullets[i].active) {
-                SPR_setPosition(bullets[i].sprite, bullets[i].x, bullets[i].y);
+                gameCore_sprSetPosition(bullets[i].sprite, bullets[i].x, bullets[i].y);
             }
         }
     }
@@ -412,7 +429,7 @@ static void updateBullets(void) {
 /** @brief Libera una bala activa y la marca como disponible. */
 static void desactivarBala(Bullet* bala) {
     if (bala->active) {
-        SPR_releaseSprite(bala->sprite);
+        gameCore_sprRelease(bala->sprite);
         bala->sprite = NULL;
         bala->active = FALSE;
         activeBullets--;
@@ -420,51 +437,59 @@ static void desactivarBala(Bullet* bala) {
 }
 
 /**
- * @brief Detecta impactos de una bala sobre campanas o bombas.
- * @param bala Bala a comprobar.
+ * @brief Registra en la rejilla las zonas de impacto de la subfase actual.
+ *
+ * Campanas o letras van antes que las bombas para conservar la prioridad de
+ * impacto; el parpadeo se filtra al consultar porque cambia a mitad de frame.
  */
-static void detectarColisionesBala(Bullet* bala) {
-    s16 balaCentroX = bala->x + 4;
-    s16 balaCentroY = bala->y + 4;
-
-    if (currentPhase == PHASE_COMPLETED) return;
+static void registrarObjetivosEnRejilla(void) {
+    gameCore_gridClear();
 
     if (currentPhase == PHASE_BELLS) {
         for (u8 i = 0; i < NUM_BELLS; i++) {
-            if (bells[i].isBlinking) continue;
-
-            if (balaCentroX >= bells[i].x &&
-                balaCentroX < bells[i].x + LETTER_WIDTH &&
-                balaCentroY >= bells[i].y + 6 &&
-                balaCentroY < bells[i].y + 26) {
-                handleBellCollision(bala, &bells[i]);
-                return;
-            }
+            gameCore_gridAdd(bells[i].x, bells[i].y + 6, LETTER_WIDTH, 20, LAYER_BELL, i);
         }
     } else if (currentPhase == PHASE_LETTERS) {
         for (u8 i = 0; i < NUM_LETTERS; i++) {
-            if (letters[i].isBlinking) continue;
-
-            if (balaCentroX >= letters[i].x &&
-                balaCentroX < letters[i].x + LETTER_WIDTH &&
-                balaCentroY >= letters[i].y + (LETTER_HEIGHT - LETTER_COLLISION_HEIGHT) / 2 &&
-                balaCentroY < letters[i].y + (LETTER_HEIGHT + LETTER_COLLISION_HEIGHT) / 2) {
-                handleLetterCollision(bala, &letters[i]);
-                return;
-            }
+            gameCore_gridAdd(letters[i].x, letters[i].y + (LETTER_HEIGHT - LETTER_COLLISION_HEIGHT) / 2,
+                LETTER_WIDTH, LETTER_COLLISION_HEIGHT, LAYER_LETTER, i);
         }
     }
 
     for (u8 i = 0; i < NUM_BOMBS; i++) {
-        if (bombs[i].isBlinking) continue;
+        gameCore_gridAdd(bombs[i].x, bombs[i].y + 6, LETTER_WIDTH, 20, LAYER_BOMB, i);
+    }
+}
+
+/**
+ * @brief Detecta impactos de una bala sobre campanas o bombas.
+ * @param bala Bala a comprobar.
+ */
+static void detectarColisionesBala(Bullet* bala) {
+    s16 balaCentroX = bala->x + 4;
+    s16 balaCentroY = bala->y + 4;
+
+    if (currentPhase == PHASE_COMPLETED) return;
 
-        if (balaCentroX >= bombs[i].x &&
-            balaCentroX < bombs[i].x + LETTER_WIDTH &&
-            balaCentroY >= bombs[i].y + 6 &&
-            balaCentroY < bombs[i].y + 26) {
-            handleBombCollision(bala, &bombs[i]);
+    u8 hits[GRID_MAX_HITS];
+    const u8 hitCount = gameCore_gridQuery(balaCentroX, balaCentroY, 1, 1,
+        LAYER_BELL | LAYER_LETTER | LAYER_BOMB, hits, GRID_MAX_HITS);
+
+    for (u8 h = 0; h < hitCount; h++) {
+        const GameGridEntry *entry = gameCore_gridGetEntry(hits[h]);
+        if (entry->layer == LAYER_BELL) {
+            if (bells[entry->id].isBlinking) continue;
+            handleBellCollision(bala, &bells[entry->id]);
+            return;
+        }
+        if (entry->layer == LAYER_LETTER) {
+            if (letters[entry->id].isBlinking) continue;
+            handleLetterCollision(bala, &letters[entry->id]);
             return;
         }
+        if (bombs[entry->id].isBlinking) continue;
+        handleBombCollision(bala, &bombs[entry->id]);
+        return;
     }
 }
 
@@ -615,13 +640,13 @@ static void startLettersPhase(void) {
 
     for (u8 i = 0; i < NUM_BELLS; i++) {
         if (bells[i].sprite) {
-            SPR_releaseSprite(bells[i].sprite);
+            gameCore_sprRelease(bells[i].sprite);
             bells[i].sprite = NULL;
         }
     }
     for (u8 i = 0; i < NUM_FIXED_BELLS; i++) {
         if (fixedBells[i].sprite) {
-            SPR_releaseSprite(fixedBells[i].sprite);
+            gameCore_sprRelease(fixedBells[i].sprite);
             fixedBells[i].sprite = NULL;
         }
     }
@@ -633,10 +658,19 @@ static void startLettersPhase(void) {
     currentLetterIndex = 0;
 }
 
+/** @brief Sube el fondo y la nieve durante la cutscene de la fase 3. */
+void minigameBells_preload(void) {
+    gameCore_vramPreload("fondo", &image_fondo_tile);
+    snowEffect_preload();
+}
+
 /** @brief Configura recursos, sprites y estado inicial de la fase. */
 void minigameBells_init(void) {
     audio_stop_music();
     gameCore_resetVideoState();
+    gameCore_resetRandomStream(GAME_RNG_BELLS);
+    qualitySnow = gameCore_qualityRegister("nieve", 2);
+    qualityBlink = gameCore_qualityRegister("parpadeo", 2);
     JOY_init();
 
     if (sprite_campana.palette) {
@@ -645,9 +679,6 @@ void minigameBells_init(void) {
     if (sprite_bomba.palette) {
         PAL_setPalette(PAL_EFFECT, sprite_bomba.palette->data, CPU);
     }
-    if (image_fondo_pal.data) {
-        PAL_setPalette(PAL_COMMON, image_fondo_pal.data, CPU);
-    }
     if (sprite_canon.palette) {
         PAL_setPalette(PAL_PLAYER, sprite_canon.palette->data, CPU);
     }
@@ -655,13 +686,13 @@ void minigameBells_init(void) {
     VDP_setBackgroundColor(0);
 
     /* Cargar fondo */
-    VDP_loadTileSet(&image_fondo_tile, globalTileIndex, CPU);
+    const u16 fondoTiles = gameCore_vramBind("fondo", &image_fondo_tile);
     mapBackground = MAP_create(&image_fondo_map, BG_B,
-        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_fondo_tile.numTile;
+        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, fondoTiles));
     MAP_scrollTo(mapBackground, 0, 0);
 
-    snowEffect_init(&snowEffect, &globalTileIndex, 2, -1);
+    snowEffect_initLayers(&snowEffect, snowLayers, sizeof(snowLayers) / sizeof(snowLayers[0]), -1);
+    gameCore_dmaFadeInWhenDone(PAL_COMMON, image_fondo_pal.data, GAME_DMA_FADE_FRAMES);
 
     /* Música */
     audio_play_phase3();
@@ -684,8 +715,8 @@ void minigameBells_init(void) {
     playerCannon = SPR_addSpriteSafe(&sprite_canon, cannonX,
         SCREEN_HEIGHT - 64,
         TILE_ATTR(PAL_PLAYER, TRUE, FALSE, FALSE));
-    SPR_setDepth(playerCannon, SPR_MIN_DEPTH);
-    SPR_setAnim(playerCannon, 0);
+    gameCore_sprSetDepth(playerCannon, SPR_MIN_DEPTH);
+    gameCore_sprSetAnim(playerCannon, 0);
     SPR_setAnimationLoop(playerCannon, FALSE);
 
     /* Balas */
@@ -718,12 +749,12 @@ void minigameBells_update(void) {
 
     /* Cañón */
     gameCore_applyInertiaAxis(&cannonX, &cannonVelocity, -32, SCREEN_WIDTH - 32, inputDirX, frameCounter, &cannonInertia);
-    SPR_setPosition(playerCannon, cannonX, SCREEN_HEIGHT - 64);
+    gameCore_sprSetPosition(playerCannon, cannonX, SCREEN_HEIGHT - 64);
 
     /* Disparos */
     if ((input & BUTTON_A) && bulletCooldown <= 0 && currentPhase != PHASE_COMPLETED) {
         cannonFiring = TRUE;
-        SPR_setAnim(playerCannon, 1);
+        gameCore_sprSetAnim(playerCannon, 1);
         fireBullet();
         bulletCooldown = BULLET_COOLDOWN_FRAMES;
     }
@@ -731,24 +762,26 @@ void minigameBells_update(void) {
     if (cannonFiring) {
         if (SPR_isAnimationDone(playerCannon)) {
             cannonFiring = FALSE;
-            SPR_setAnim(playerCannon, 0);
+            gameCore_sprSetAnim(playerCannon, 0);
         }
     }
 
     /* Paralaje */
-    snowEffect_update(&snowEffect, frameCounter);
+    if (gameCore_qualityShouldRun(qualitySnow)) {
+        snowEffect_update(&snowEffect, frameCounter);
+    }
 
     /* Actualizar objetos */
     if (currentPhase == PHASE_BELLS) {
         for (u8 i = 0; i < NUM_BELLS; i++) {
             updateBell(&bells[i]);
         }
-        updateFixedBells();
+        if (gameCore_qualityShouldRun(qualityBlink)) updateFixedBells();
     } else if (currentPhase == PHASE_LETTERS) {
         for (u8 i = 0; i < NUM_LETTERS; i++) {
             updateLetter(&letters[i]);
         }
-        updateFeliz2025Blink();
+        if (gameCore_qualityShouldRun(qualityBlink)) updateFeliz2025Blink();
     }
 
     for (u8 i = 0; i < NUM_BOMBS; i++) {
@@ -763,10 +796,9 @@ void minigameBells_update(void) {
     if (bulletCooldown > 0) bulletCooldown--;
 }
 
-/** @brief Renderiza sprites y sincroniza con VBlank. */
+/** @brief Renderiza sprites; el VBlank lo procesa gameCore_runPhaseLoop. */
 void minigameBells_render(void) {
     SPR_update();
-    SYS_doVBlankProcess();
 }
 
 /**
@@ -784,3 +816,29 @@ void minigameBells_shutdown(void) {
         mapBackground = NULL;
     }
 }
+
+/**
+ * @brief Lleva la fase a su peor caso: todas las balas, campanas y bombas en pantalla.
+ *
+ * Lo que aún espera por encima del borde superior se baja a una altura
+ * aleatoria visible; las balas se disparan sin respetar el enfriamiento.
+ */
+void minigameBells_forceStress(void) {
+    const s16 visibleRange = SCREEN_HEIGHT - 64 - 32;
+    if (currentPhase == PHASE_BELLS) {
+        for (u8 i = 0; i < NUM_BELLS; i++) {
+            if (bells[i].y < 0) bells[i].y = gameCore_randomRange(GAME_RNG_BELLS, visibleRange);
+        }
+    } else if (currentPhase == PHASE_LETTERS) {
+        for (u8 i = 0; i < NUM_LETTERS; i++) {
+            if (letters[i].y < 0) letters[i].y = gameCore_randomRange(GAME_RNG_BELLS, visibleRange);
+        }
+    }
+    for (u8 i = 0; i < NUM_BOMBS; i++) {
+        if (bombs[i].y < 0) bombs[i].y = gameCore_randomRange(GAME_RNG_BELLS, visibleRange);
+    }
+    if (currentPhase == PHASE_COMPLETED) return;
+    while (activeBullets < NUM_BULLETS) {
+        fireBullet();
+    }
+}
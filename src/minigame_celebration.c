@@ -66,7 +66,7 @@ void minigameCelebration_update(void) {
 }
 
 void minigameCelebration_render(void) {
-    SYS_doVBlankProcess();
+    /* Sin sprites: solo texto en planos; el VBlank lo procesa gameCore_runPhaseLoop. */
 }
 
 u8 minigameCelebration_isComplete(void) {
@@ -81,12 +81,10 @@ void minigameCelebration_shutdown(void) {
 }
 
 static void loadCelebrationBackground(void) {
-    gameCore_resetTileIndex();
-
-    VDP_loadTileSet(&image_fondo_fiesta_tile, globalTileIndex, CPU);
+    const u16 fondoTiles = gameCore_vramAlloc("fondo_fiesta", image_fondo_fiesta_tile.numTile);
+    VDP_loadTileSet(&image_fondo_fiesta_tile, fondoTiles, CPU);
     celebrationMap = MAP_create(&image_fondo_fiesta_map, BG_B,
-        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_fondo_tile.numTile;
+        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, fondoTiles));
     PAL_setPalette(PAL_COMMON, image_fondo_fiesta_pal.data, CPU);
     MAP_scrollTo(celebrationMap, 0, 0);
     (void)celebrationMap;
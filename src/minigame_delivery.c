@@ -5,7 +5,7 @@
  * Recursos y paletas empleados en la fase:
  * - Fondos y tiles de tejados definidos en `resources_bg.h` (mapa y tileset del
  *   tejado). La paleta asociada al fondo se carga desde ese mismo fichero y se
- *   aplica al `mapBackground`.
+ *   aplica al `backgroundPlane` (bucle volcado al plano B).
  * - Sprites de Santa, enemigos y regalos procedentes de `resources_sprites.h`.
  *   Cada sprite usa la paleta incluida en dicho fichero; se hace referencia a
  *   ella al crear los sprites en `initSanta`, `initEnemies` y `initGiftDrops`.
@@ -30,6 +30,7 @@
 #define WORLD_WIDTH SCREEN_WIDTH        /* Ancho jugable fijado a la pantalla. */
 #define WORLD_HEIGHT 512                /* Altura total del bucle vertical. */
 #define SCROLL_LOOP_PX WORLD_HEIGHT     /* Tamaño del loop de scroll en píxeles. */
+#define BACKGROUND_WIDTH_PX 320         /* Ancho del mapa de tejados. */
 #define SCROLL_SPEED_PER_FRAME FIX16(2) /* Velocidad de avance vertical. */
 #define CHIMNEY_SIZE 32                 /* Tamaño (ancho/alto) de cada chimenea. */
 #define CHIMNEY_MARGIN_X 4              /* Margen lateral respecto al borde. */
@@ -38,6 +39,11 @@
 #define CHIMNEY_PROHIBITED_PERCENT 30   /* Probabilidad % de chimenea prohibida. */
 #define CHIMNEY_PRESET_LEFT_COUNT 5
 #define CHIMNEY_PRESET_RIGHT_COUNT 5
+#define CHIMNEY_PRESET_COUNT (CHIMNEY_PRESET_LEFT_COUNT + CHIMNEY_PRESET_RIGHT_COUNT) /* Uno por bit de u16. */
+#define CHIMNEY_PRESET_NONE 0xFF        /* Chimenea sin preset reservado. */
+#if CHIMNEY_PRESET_COUNT > GAME_POOL_MAX_SLOTS
+#error "La ocupación de presets de chimenea es una máscara u16"
+#endif
 #define CHIMNEY_HITBOX_OFFSET_X 6
 #define CHIMNEY_HITBOX_OFFSET_Y 7
 #define CHIMNEY_HITBOX_WIDTH 19
@@ -48,6 +54,7 @@
 #define ENEMY_CHASE_SPEED (ENEMY_SPEED * 2) /* mas rapido al perseguir regalos. */
 #define ENEMY_DIR_CHANGE_MIN_FRAMES (2 * 60)
 #define ENEMY_DIR_CHANGE_MAX_FRAMES (3 * 60)
+#define ENEMY_AI_PER_FRAME 1            /* Enemigos que deciden (persecución, rumbo) cada frame. */
 #define ENEMY_STEAL_ANIM_FRAMES 5
 #define ENEMY_HITBOX_OFFSET_X 5
 #define ENEMY_HITBOX_OFFSET_Y 6
@@ -93,27 +100,46 @@
 #define DEPTH_EFFECTS (DEPTH_SANTA + 8)
 #define DEPTH_BACKGROUND (DEPTH_EFFECTS + 8)
 #define DEPTH_MARKERS (DEPTH_BACKGROUND - 2)
+#define DEPTH_ACTORS_START DEPTH_SANTA /* Santa, enemigos y regalos se ordenan por su base desde aquí. */
+
+#define LAYER_CHIMNEY 0x01 /* Capa de rejilla: chimeneas (todas). */
+#define LAYER_ENEMY 0x02   /* Capa de rejilla: duendes voladores activos. */
+#define GRID_MAX_HITS (NUM_CHIMNEYS + MAX_ENEMIES) /* Impactos que devuelve cada consulta. */
 
 static const s16 chimneyLeftPresetY[CHIMNEY_PRESET_LEFT_COUNT] = { 30, 160, 270, 400, 436 };
 static const s16 chimneyRightPresetY[CHIMNEY_PRESET_RIGHT_COUNT] = { 48, 82, 216, 324, 458 };
 
+/** @brief Bandas de nieve: arriba lejos y lenta, abajo cerca y amplia. */
+static const SnowLayer snowLayers[] = {
+    { 9, 1, 24 },
+    { 9, 2, 40 },
+    { 10, 3, SNOW_SWAY_PX },
+};
+
 enum {
     CHIMNEY_INACTIVE = 0,
     CHIMNEY_ACTIVE = 1,
     CHIMNEY_COOLDOWN = 2,
 };
 
+/** @brief Aspecto de la chimenea; es la animación de sprite_chimenea. */
+enum {
+    CHIMNEY_LOOK_NORMAL = 0,
+    CHIMNEY_LOOK_PROHIBITED = 1,
+    CHIMNEY_LOOK_USED = 2,
+};
+
 typedef struct {
-    Sprite* sprite;
-    Sprite* blockedSprite;
-    Sprite* usedSprite;
+    Sprite* sprite; /**< Único sprite; cambia de definición según look. */
     s16 x;
     s16 y;
+    u8 look; /**< CHIMNEY_LOOK_* aplicado al sprite. */
     u8 state;
     u16 cooldown;
     u8 blink;
     u8 prohibited;
     u16 toggleTimer;
+    u8 preset; /**< Preset que ocupa (CHIMNEY_PRESET_NONE si ninguno). */
 } Chimney;
 
 typedef struct {
@@ -138,15 +164,19 @@ typedef struct {
     s16 y;
     s16 targetX;
     s16 targetY;
-    fix16 fx;
-    fix16 fy;
-    fix16 vx;
-    fix16 vy;
-    u16 framesToTarget;
+    GameLineStepper path; /**< Vuelo recto hasta (targetX, targetY). */
     u8 active;
     u8 pending;
 } GiftDrop;
 
+/** @brief Regalo más amenazado y el enemigo que lo persigue. */
+typedef struct {
+    s8 drop;   /**< Regalo seguido (-1 si ninguno). */
+    s8 chaser; /**< Enemigo asignado (-1 si ninguno). */
+    s16 x;     /**< Centro vivo del regalo seguido. */
+    s16 y;     /**< Centro vivo del regalo seguido. */
+} GiftTarget;
+
 typedef struct {
     Sprite* sprite;
     s16 x;
@@ -162,12 +192,13 @@ static u8 santaThrowing; /**< TRUE mientras Santa ejecuta la animación de lanza
 static u8 santaThrowGiftSpawned; /**< TRUE cuando el regalo ya se generó en la animación. */
 static u8 santaReturnToIdle; /**< Solicitud de volver a la animación base. */
 
-static Map* mapBackground; /**< Mapa del plano B para el tejado. */
+static GameLoopPlane backgroundPlane; /**< Tejados en bucle sobre BG_B. */
 static s16 backgroundOffsetY; /**< Offset vertical del scroll de fondo. */
 static fix16 backgroundOffsetFY; /**< Offset vertical de scroll en fix16. */
 static fix16 scrollSpeedPerFrame; /**< Velocidad de scroll por frame. */
 static SnowEffect snowEffect; /**< Efecto de nieve compartido. */
 static GameTimer gameTimer; /**< Temporizador de la fase para derrota. */
+static GameDepthList depthList; /**< Orden de profundidad de Santa, enemigos y regalos. */
 
 static Sprite* giftCounterTop; /**< Contador gráfico fila superior. */
 static Sprite* giftCounterBottom; /**< Contador gráfico fila inferior. */
@@ -184,6 +215,14 @@ static u8 phaseCompleted; /**< Marca de finalización de fase. */
 static s8 dropCooldown; /**< Enfriamiento entre lanzamientos de regalo. */
 static u16 recoveringFrames; /**< Ventana de invulnerabilidad tras daño. */
 static u16 previousInput; /**< Entrada anterior para filtrar transiciones. */
+static u8 stressMode; /**< Banco de estrés: todos los enemigos activos desde el inicio. */
+static u16 chimneyPresetUsable; /**< Presets que no se solapan entre sí en el bucle. */
+static u16 chimneyPresetUsed; /**< Presets ocupados ahora por una chimenea. */
+static GameAiSlicer enemyAi; /**< Turnos de decisión de los enemigos. */
+static GiftTarget giftTarget; /**< Persecución en curso (regalo y enemigo). */
+static u8 qualitySnow; /**< Efecto opcional: animación de la nieve. */
+static u8 qualityHudBlink; /**< Efecto opcional: parpadeo del HUD. */
+static u8 qualityDepth; /**< Efecto opcional: reordenado de profundidad. */
 
 static void initBackground(void);
 static void initSanta(void);
@@ -195,16 +234,21 @@ static s16 advanceVerticalScroll(void);
 static void applyBackgroundScroll(s16 scrollStep);
 static void updateChimneys(s16 scrollStep);
 static void updateEnemies(s16 scrollStep);
+static void registerCollisionGrid(void);
 static void updateGiftDrops(s16 scrollStep);
+static void reorderActorDepths(void);
 static void updateSantaThrowState(void);
 static void respawnEnemyFromTop(Enemy* enemy, u8 offsetIndex);
-static s16 pickChimneyPresetY(u8 spawnRight);
+static void initChimneyPresets(void);
+static void applyChimneyLook(Chimney* chimney);
+static s16 chimneyPresetMapY(u8 preset);
 static s16 mapYToScreenY(s16 mapY, u8 spawnAboveTop);
-static u8 chimneysOverlapAt(s16 x, s16 y, u8 selfIndex);
-static void placeChimneyAtPreset(Chimney* chimney, u8 index, u8 spawnAboveTop);
+static void placeChimneyAtPreset(Chimney* chimney, u8 spawnAboveTop);
 static u8 rollChimneyProhibited(void);
 static u16 rollChimneyToggleFrames(void);
 static u16 rollEnemyDirectionTimer(void);
+static void rerollEnemyDirection(Enemy* enemy);
+static u32 enemyDistanceSq(const Enemy* enemy, s16 targetX, s16 targetY);
 static void updateGiftCounter(void);
 static void spawnGiftDrop(void);
 static void startGiftThrow(void);
@@ -220,16 +264,27 @@ static void updateEnemyActivation(void);
 static u8 getTargetEnemyCount(void);
 static void deactivateGiftDrop(GiftDrop* drop);
 static u8 checkGiftEnemyCollision(GiftDrop* drop);
-static u8 getActiveGiftTargetPos(s16* targetX, s16* targetY);
+static u8 getGiftDropThreatPos(const GiftDrop* drop, s16* x, s16* y);
+static void updateGiftTarget(u16 aiTurn);
 static Chimney* findNearestChimneyInRange(s16 centerX, s16 centerY, u16 radius, s32* outDistanceSq);
 static void onGiftSuccess(void);
 static void playRandomElfStealSound(void);
 static void playGiftDeliveredSound(void);
 static void playGiftLostSound(void);
 
+/** @brief Sube los tejados y la nieve durante la cutscene de la fase 2. */
+void minigameDelivery_preload(void) {
+    gameCore_vramPreload("fondo_tejados", &image_fondo_tejados_tile);
+    snowEffect_preload();
+}
+
 /** @brief Configura recursos, estado inicial de la fase. */
 void minigameDelivery_init(void) {
     gameCore_resetVideoState();
+    gameCore_resetRandomStream(GAME_RNG_DELIVERY);
+    qualitySnow = gameCore_qualityRegister("nieve", 2);
+    qualityHudBlink = gameCore_qualityRegister("hud", 4);
+    qualityDepth = gameCore_qualityRegister("profundidad", 4);
     // kprintf("[SANTA] starting Santa init at pos=(%d,%d)", (WORLD_WIDTH - SANTA_WIDTH) / 2, SANTA_START_Y);
 
     frameCounter = 0;
@@ -239,6 +294,7 @@ void minigameDelivery_init(void) {
     dropCooldown = 0;
     recoveringFrames = 0;
     previousInput = 0;
+    stressMode = FALSE;
     santaThrowing = FALSE;
     santaThrowGiftSpawned = FALSE;
     santaReturnToIdle = FALSE;
@@ -253,6 +309,7 @@ void minigameDelivery_init(void) {
 
     
     initBackground();
+    gameCore_depthInit(&depthList, DEPTH_ACTORS_START);
     initSanta();
     initChimneys();
     initEnemies();
@@ -271,7 +328,9 @@ void minigameDelivery_init(void) {
 void minigameDelivery_update(void) {
     frameCounter++;
 
-    snowEffect_update(&snowEffect, frameCounter);
+    if (gameCore_qualityShouldRun(qualitySnow)) {
+        snowEffect_update(&snowEffect, frameCounter);
+    }
 
     u16 input = gameCore_readInput();
     updateSantaThrowState();
@@ -314,16 +373,22 @@ void minigameDelivery_update(void) {
     applyBackgroundScroll(scrollStep);
     updateChimneys(scrollStep);
     updateEnemies(scrollStep);
+    registerCollisionGrid();
     updateGiftDrops(scrollStep);
 
-    SPR_setPosition(santa.sprite, santa.x, santa.y);
+    gameCore_sprSetPosition(santa.sprite, santa.x, santa.y);
 
     if (recoveringFrames == 0) {
         checkEnemyCollision();
     }
+    if (gameCore_qualityShouldRun(qualityDepth)) {
+        reorderActorDepths();
+    }
 
     gameCore_updateTimer(&gameTimer);
-    updateGiftCounter();
+    if (gameCore_qualityShouldRun(qualityHudBlink)) {
+        updateGiftCounter();
+    }
 
     if (giftCounterValue >= DELIVERY_TARGET) {
         phaseCompleted = TRUE;
@@ -332,10 +397,9 @@ void minigameDelivery_update(void) {
     previousInput = input;
 }
 
-/** @brief Sincroniza sprites y espera a VBlank. */
+/** @brief Sincroniza sprites; el VBlank lo procesa gameCore_runPhaseLoop. */
 void minigameDelivery_render(void) {
     SPR_update();
-    SYS_doVBlankProcess();
 }
 
 /** @brief Indica si se alcanzó el objetivo de entregas. */
@@ -345,21 +409,31 @@ u8 minigameDelivery_isComplete(void) {
 
 /** @brief Libera el mapa de fondo y evita fugas entre fases. */
 void minigameDelivery_shutdown(void) {
-    if (mapBackground) {
-        MAP_release(mapBackground);
-        mapBackground = NULL;
+    gameCore_loopPlaneRelease(&backgroundPlane);
+}
+
+/**
+ * @brief Lleva la fase a su peor caso: todos los enemigos y todos los regalos en vuelo.
+ *
+ * Cada hueco libre de drops[] se lanza al momento saltándose el enfriamiento
+ * y la animación de Santa, con el mismo apuntado que un lanzamiento normal.
+ */
+void minigameDelivery_forceStress(void) {
+    stressMode = TRUE;
+    updateEnemyActivation();
+    for (u8 i = 0; i < NUM_GIFT_DROPS; i++) {
+        if (drops[i].active || drops[i].pending) continue;
+        dropCooldown = 0;
+        santaThrowing = FALSE;
+        startGiftThrow();
+        spawnGiftDrop();
     }
 }
 
 static void initBackground(void) {
-    gameCore_resetTileIndex();
-
     backgroundOffsetFY = FIX16(backgroundOffsetY);
     scrollSpeedPerFrame = SCROLL_SPEED_PER_FRAME;
 
-    if (image_fondo_tejados_pal.data) {
-        PAL_setPalette(PAL_COMMON, image_fondo_tejados_pal.data, CPU);
-    }
     if (sprite_santa_car_volando.palette) {
         PAL_setPalette(PAL_PLAYER, sprite_santa_car_volando.palette->data, CPU);
     } else if (sprite_santa_car.palette) {
@@ -371,16 +445,14 @@ static void initBackground(void) {
 
     VDP_setBackgroundColor(0);
 
-    VDP_loadTileSet(&image_fondo_tejados_tile, globalTileIndex, CPU);
-    mapBackground = MAP_create(&image_fondo_tejados_map, BG_B,
-        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_fondo_tejados_tile.numTile;
-    if (mapBackground != NULL) {
-        MAP_scrollTo(mapBackground, 0, backgroundOffsetY);
-    }
-    SYS_doVBlankProcess();
+    const u16 fondoTiles = gameCore_vramBind("fondo_tejados", &image_fondo_tejados_tile);
+    gameCore_loopPlaneInit(&backgroundPlane, &image_fondo_tejados_map, BG_B,
+        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, fondoTiles),
+        BACKGROUND_WIDTH_PX, SCROLL_LOOP_PX, backgroundOffsetY);
+    gameCore_waitVBlank();
 
-    snowEffect_init(&snowEffect, &globalTileIndex, 2, -8);
+    snowEffect_initLayers(&snowEffect, snowLayers, sizeof(snowLayers) / sizeof(snowLayers[0]), -8);
+    gameCore_dmaFadeInWhenDone(PAL_COMMON, image_fondo_tejados_pal.data, GAME_DMA_FADE_FRAMES);
 
 }
 
@@ -395,11 +467,11 @@ static void initSanta(void) {
         TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
     if (santa.sprite) {
         // kprintf("[SANTA] sprite created successfully");
-        SPR_setDepth(santa.sprite, DEPTH_SANTA);
+        gameCore_sprSetDepth(santa.sprite, DEPTH_SANTA);
         SPR_setAutoAnimation(santa.sprite, TRUE);
         SPR_setAnimationLoop(santa.sprite, TRUE);
         SPR_setFrameChangeCallback(santa.sprite, onSantaFrameChange);
-        SPR_setVisibility(santa.sprite, VISIBLE);
+        gameCore_sprSetVisibility(santa.sprite, VISIBLE);
         // kprintf("[SANTA] sprite ok depth=%d pos=(%d,%d)", DEPTH_SANTA, santa.x, santa.y);
     } else {
         // kprintf("[SANTA][ERROR] sprite not created");
@@ -408,45 +480,36 @@ static void initSanta(void) {
 
 static void initChimneys(void) {
     memset(chimneys, 0, sizeof(chimneys));
+    initChimneyPresets();
     for (u8 i = 0; i < NUM_CHIMNEYS; i++) {
+        chimneys[i].preset = CHIMNEY_PRESET_NONE;
         chimneys[i].state = CHIMNEY_ACTIVE;
         chimneys[i].cooldown = 0;
         chimneys[i].blink = 0;
         chimneys[i].prohibited = rollChimneyProhibited();
         chimneys[i].toggleTimer = rollChimneyToggleFrames();
-        placeChimneyAtPreset(&chimneys[i], i, TRUE);
+        placeChimneyAtPreset(&chimneys[i], TRUE);
 
+        chimneys[i].look = chimneys[i].prohibited ? CHIMNEY_LOOK_PROHIBITED : CHIMNEY_LOOK_NORMAL;
         chimneys[i].sprite = SPR_addSpriteSafe(&sprite_chimenea,
             chimneys[i].x, chimneys[i].y,
             TILE_ATTR(PAL_COMMON, FALSE, FALSE, FALSE));
-        chimneys[i].blockedSprite = SPR_addSpriteSafe(&sprite_chimenea_prohibida,
-            chimneys[i].x, chimneys[i].y,
-            TILE_ATTR(PAL_COMMON, FALSE, FALSE, FALSE));
-        chimneys[i].usedSprite = SPR_addSpriteSafe(&sprite_chimenea_utilizada,
-            chimneys[i].x, chimneys[i].y,
-            TILE_ATTR(PAL_COMMON, FALSE, FALSE, FALSE));
         const u8 visible = (chimneys[i].y + CHIMNEY_SIZE > 0) && (chimneys[i].y < SCREEN_HEIGHT);
         if (chimneys[i].sprite) {
-            SPR_setDepth(chimneys[i].sprite, DEPTH_BACKGROUND);
-            SPR_setVisibility(chimneys[i].sprite,
-                (!chimneys[i].prohibited && visible) ? VISIBLE : HIDDEN);
-        }
-        if (chimneys[i].blockedSprite) {
-            SPR_setDepth(chimneys[i].blockedSprite, DEPTH_BACKGROUND);
-            SPR_setVisibility(chimneys[i].blockedSprite,
-                (chimneys[i].prohibited && visible) ? VISIBLE : HIDDEN);
-        }
-        if (chimneys[i].usedSprite) {
-            SPR_setDepth(chimneys[i].usedSprite, DEPTH_BACKGROUND);
-            SPR_setAutoAnimation(chimneys[i].usedSprite, TRUE);
-            SPR_setAnimationLoop(chimneys[i].usedSprite, TRUE);
-            SPR_setVisibility(chimneys[i].usedSprite, HIDDEN);
+            gameCore_sprSetDepth(chimneys[i].sprite, DEPTH_BACKGROUND);
+            gameCore_sprSetAnim(chimneys[i].sprite, chimneys[i].look);
+            SPR_setAutoAnimation(chimneys[i].sprite, TRUE);
+            SPR_setAnimationLoop(chimneys[i].sprite, TRUE);
+            gameCore_sprSetVisibility(chimneys[i].sprite, visible ? VISIBLE : HIDDEN);
         }
     }
 }
 
 static void initEnemies(void) {
     memset(enemies, 0, sizeof(enemies));
+    gameCore_aiSlicerInit(&enemyAi, MAX_ENEMIES, ENEMY_AI_PER_FRAME);
+    giftTarget.drop = -1;
+    giftTarget.chaser = -1;
     for (u8 i = 0; i < MAX_ENEMIES; i++) {
         enemies[i].active = FALSE;
         enemies[i].vx = 0;
@@ -456,7 +519,7 @@ static void initEnemies(void) {
         enemies[i].sprite = SPR_addSpriteSafe(&sprite_duende_malo_volador, 0, 0,
             TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
         if (enemies[i].sprite) {
-            SPR_setDepth(enemies[i].sprite, DEPTH_EFFECTS);
+            gameCore_sprSetDepth(enemies[i].sprite, DEPTH_EFFECTS);
             SPR_setAutoAnimation(enemies[i].sprite, TRUE);
         } else {
             continue;
@@ -473,23 +536,18 @@ static void initGiftDrops(void) {
         drops[i].active = FALSE;
         drops[i].targetX = 0;
         drops[i].targetY = 0;
-        drops[i].fx = FIX16(0);
-        drops[i].fy = FIX16(0);
-        drops[i].vx = FIX16(0);
-        drops[i].vy = FIX16(0);
-        drops[i].framesToTarget = 0;
         drops[i].pending = FALSE;
         drops[i].targetSprite = SPR_addSpriteSafe(&sprite_marca_x_2, 0, 0,
             TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
         if (drops[i].sprite) {
-            SPR_setDepth(drops[i].sprite, DEPTH_EFFECTS);
+            gameCore_sprSetDepth(drops[i].sprite, DEPTH_EFFECTS);
             SPR_setAutoAnimation(drops[i].sprite, FALSE);
-            SPR_setAnim(drops[i].sprite, 0);
-            SPR_setVisibility(drops[i].sprite, HIDDEN);
+            gameCore_sprSetAnim(drops[i].sprite, 0);
+            gameCore_sprSetVisibility(drops[i].sprite, HIDDEN);
         }
         if (drops[i].targetSprite) {
-            SPR_setDepth(drops[i].targetSprite, DEPTH_MARKERS);
-            SPR_setVisibility(drops[i].targetSprite, HIDDEN);
+            gameCore_sprSetDepth(drops[i].targetSprite, DEPTH_MARKERS);
+            gameCore_sprSetVisibility(drops[i].targetSprite, HIDDEN);
         }
     }
 }
@@ -502,9 +560,9 @@ static void initGiftCounterSprites(void) {
         TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     if (giftCounterTop) {
         SPR_setAutoAnimation(giftCounterTop, FALSE);
-        SPR_setDepth(giftCounterTop, DEPTH_HUD + 1);
-        SPR_setFrame(giftCounterTop, 0);
-        SPR_setVisibility(giftCounterTop, VISIBLE);
+        gameCore_sprSetDepth(giftCounterTop, DEPTH_HUD + 1);
+        gameCore_sprSetFrame(giftCounterTop, 0);
+        gameCore_sprSetVisibility(giftCounterTop, VISIBLE);
         // kprintf("[HUD] giftCounterTop pos=(%d,%d)", baseX, baseY - GIFT_COUNTER_ROW_OFFSET_Y);
     }
 
@@ -512,9 +570,9 @@ static void initGiftCounterSprites(void) {
         TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     if (giftCounterBottom) {
         SPR_setAutoAnimation(giftCounterBottom, FALSE);
-        SPR_setDepth(giftCounterBottom, DEPTH_HUD);
-        SPR_setFrame(giftCounterBottom, 0);
-        SPR_setVisibility(giftCounterBottom, VISIBLE);
+        gameCore_sprSetDepth(giftCounterBottom, DEPTH_HUD);
+        gameCore_sprSetFrame(giftCounterBottom, 0);
+        gameCore_sprSetVisibility(giftCounterBottom, VISIBLE);
         // kprintf("[HUD] giftCounterBottom pos=(%d,%d)", baseX + GIFT_COUNTER_SECOND_ROW_OFFSET_X, baseY);
     }
 
@@ -543,18 +601,19 @@ static s16 advanceVerticalScroll(void) {
 }
 
 static void applyBackgroundScroll(s16 scrollStep) {
-    if (mapBackground != NULL && scrollStep > 0) {
-        MAP_scrollTo(mapBackground, 0, backgroundOffsetY);
+    if (scrollStep > 0) {
+        gameCore_loopPlaneScroll(&backgroundPlane, backgroundOffsetY);
     }
 }
 
 static s16 mapYToScreenY(s16 mapY, u8 spawnAboveTop) {
+    /* mapY y backgroundOffsetY están en [0, SCROLL_LOOP_PX): basta una corrección por lado. */
     s16 screenY = mapY - backgroundOffsetY;
 
-    while (screenY <= -CHIMNEY_SIZE) {
+    if (screenY <= -CHIMNEY_SIZE) {
         screenY += SCROLL_LOOP_PX;
     }
-    while (screenY > SCREEN_HEIGHT) {
+    if (screenY > SCREEN_HEIGHT) {
         screenY -= SCROLL_LOOP_PX;
     }
 
@@ -565,71 +624,72 @@ static s16 mapYToScreenY(s16 mapY, u8 spawnAboveTop) {
     return screenY;
 }
 
-static s16 pickChimneyPresetY(u8 spawnRight) {
-    const s16* list = spawnRight ? chimneyRightPresetY : chimneyLeftPresetY;
-    const u8 count = spawnRight ? CHIMNEY_PRESET_RIGHT_COUNT : CHIMNEY_PRESET_LEFT_COUNT;
-    const u8 index = random() % count;
-    return list[index];
+/** @brief Y en el bucle del preset (0..LEFT_COUNT-1 izquierda, el resto derecha). */
+static s16 chimneyPresetMapY(u8 preset) {
+    return (preset < CHIMNEY_PRESET_LEFT_COUNT) ? chimneyLeftPresetY[preset]
+        : chimneyRightPresetY[preset - CHIMNEY_PRESET_LEFT_COUNT];
 }
 
-static u8 chimneysOverlapAt(s16 x, s16 y, u8 selfIndex) {
-    for (u8 i = 0; i < NUM_CHIMNEYS; i++) {
-        if (i == selfIndex) continue;
-        const Chimney* other = &chimneys[i];
-        if (other->state == CHIMNEY_INACTIVE) continue;
-
-        const u8 overlap =
-            (x < (other->x + CHIMNEY_SIZE)) &&
-            ((x + CHIMNEY_SIZE) > other->x) &&
-            (y < (other->y + CHIMNEY_SIZE)) &&
-            ((y + CHIMNEY_SIZE) > other->y);
-        if (overlap) {
-            return TRUE;
+/**
+ * @brief Calcula qué presets pueden estar ocupados a la vez sin solaparse.
+ *
+ * Dos presets del mismo lado chocan si su distancia en el bucle es menor que
+ * una chimenea; de cada pareja se queda el primero. Con eso basta un bit de
+ * ocupación por preset para garantizar que dos chimeneas nunca se pisan.
+ */
+static void initChimneyPresets(void) {
+    chimneyPresetUsable = 0;
+    chimneyPresetUsed = 0;
+    for (u8 p = 0; p < CHIMNEY_PRESET_COUNT; p++) {
+        const u8 right = (p >= CHIMNEY_PRESET_LEFT_COUNT);
+        u8 clear = TRUE;
+        u16 usable = chimneyPresetUsable;
+        while (usable) {
+            const u8 q = gameCore_poolNextSlot(&usable);
+            if ((q >= CHIMNEY_PRESET_LEFT_COUNT) != right) continue;
+            s16 gap = abs16(chimneyPresetMapY(p) - chimneyPresetMapY(q));
+            if (gap > SCROLL_LOOP_PX / 2) gap = SCROLL_LOOP_PX - gap;
+            if (gap < CHIMNEY_SIZE) {
+                clear = FALSE;
+                break;
+            }
+        }
+        if (!clear) {
+            // kprintf("[CHIMNEY] preset %u se solapa con otro; se descarta", p);
+            continue;
         }
+        chimneyPresetUsable |= (u16)(1 << p);
     }
-
-    return FALSE;
 }
 
-static void placeChimneyAtPreset(Chimney* chimney, u8 index, u8 spawnAboveTop) {
+static void placeChimneyAtPreset(Chimney* chimney, u8 spawnAboveTop) {
     if (chimney == NULL) return;
 
-    const u8 maxAttempts = 12;
-    for (u8 attempt = 0; attempt < maxAttempts; attempt++) {
-        const u8 spawnRight = random() & 1;
-        const s16 mapY = pickChimneyPresetY(spawnRight);
-        const s16 screenY = mapYToScreenY(mapY, spawnAboveTop);
-        const s16 x = spawnRight ? CHIMNEY_X_RIGHT : CHIMNEY_X_LEFT;
-
-        if (!chimneysOverlapAt(x, screenY, index)) {
-            chimney->x = x;
-            chimney->y = screenY;
-            return;
-        }
+    if (chimney->preset != CHIMNEY_PRESET_NONE) {
+        chimneyPresetUsed &= (u16)~(1 << chimney->preset);
+        chimney->preset = CHIMNEY_PRESET_NONE;
     }
 
-    for (u8 side = 0; side < 2; side++) {
-        const u8 spawnRight = (side != 0);
-        const s16* list = spawnRight ? chimneyRightPresetY : chimneyLeftPresetY;
-        const u8 count = spawnRight ? CHIMNEY_PRESET_RIGHT_COUNT : CHIMNEY_PRESET_LEFT_COUNT;
-        for (u8 i = 0; i < count; i++) {
-            const s16 mapY = list[i];
-            const s16 screenY = mapYToScreenY(mapY, spawnAboveTop);
-            const s16 x = spawnRight ? CHIMNEY_X_RIGHT : CHIMNEY_X_LEFT;
-            if (!chimneysOverlapAt(x, screenY, index)) {
-                chimney->x = x;
-                chimney->y = screenY;
-                return;
-            }
-        }
+    /* Rota la máscara libre a un origen aleatorio y toma el primer bit: un
+     * preset libre al azar sin reintentos. */
+    const u16 allPresets = (u16)((1 << CHIMNEY_PRESET_COUNT) - 1);
+    const u16 free = chimneyPresetUsable & (u16)~chimneyPresetUsed;
+    u8 preset = 0;
+    if (free) {
+        const u8 start = gameCore_randomRange(GAME_RNG_DELIVERY, CHIMNEY_PRESET_COUNT);
+        u16 rotated = (u16)(((free >> start) | (free << (CHIMNEY_PRESET_COUNT - start))) & allPresets);
+        preset = gameCore_poolNextSlot(&rotated) + start;
+        if (preset >= CHIMNEY_PRESET_COUNT) preset -= CHIMNEY_PRESET_COUNT;
+        chimneyPresetUsed |= (u16)(1 << preset);
+        chimney->preset = preset;
     }
 
-    chimney->x = CHIMNEY_X_LEFT;
-    chimney->y = mapYToScreenY(chimneyLeftPresetY[0], spawnAboveTop);
+    chimney->x = (preset < CHIMNEY_PRESET_LEFT_COUNT) ? CHIMNEY_X_LEFT : CHIMNEY_X_RIGHT;
+    chimney->y = mapYToScreenY(chimneyPresetMapY(preset), spawnAboveTop);
 }
 
 static u8 rollChimneyProhibited(void) {
-    u16 roll = random() % 100;
+    u16 roll = gameCore_randomRange(GAME_RNG_DELIVERY, 100);
     return (roll < CHIMNEY_PROHIBITED_PERCENT) ? TRUE : FALSE;
 }
 
@@ -637,7 +697,7 @@ static u16 rollChimneyToggleFrames(void) {
     const u16 minFrames = CHIMNEY_TOGGLE_MIN_FRAMES;
     const u16 maxFrames = CHIMNEY_TOGGLE_MAX_FRAMES;
     const u16 span = (maxFrames > minFrames) ? (maxFrames - minFrames) : 0;
-    const u16 randomOffset = span ? (random() % (span + 1)) : 0;
+    const u16 randomOffset = span ? gameCore_randomRange(GAME_RNG_DELIVERY, span + 1) : 0;
     return minFrames + randomOffset;
 }
 
@@ -663,73 +723,48 @@ static void updateChimneys(s16 scrollStep) {
             chimney->y += scrollStep;
         }
         if (chimney->y > SCREEN_HEIGHT) {
-            placeChimneyAtPreset(chimney, i, TRUE);
+            placeChimneyAtPreset(chimney, TRUE);
             chimney->prohibited = rollChimneyProhibited();
             chimney->state = CHIMNEY_ACTIVE;
             chimney->cooldown = 0;
             chimney->blink = 0;
             chimney->toggleTimer = rollChimneyToggleFrames();
-            if (chimney->usedSprite) {
-                SPR_setVisibility(chimney->usedSprite, HIDDEN);
-            }
         }
 
-        s16 screenX = chimney->x;
-        u8 visible = (chimney->y + CHIMNEY_SIZE > 0) && (chimney->y < SCREEN_HEIGHT);
+        const u8 visible = (chimney->y + CHIMNEY_SIZE > 0) && (chimney->y < SCREEN_HEIGHT);
+        applyChimneyLook(chimney);
         if (chimney->sprite) {
-            SPR_setPosition(chimney->sprite, screenX, chimney->y);
-        }
-        if (chimney->blockedSprite) {
-            SPR_setPosition(chimney->blockedSprite, screenX, chimney->y);
-        }
-        if (chimney->usedSprite) {
-            SPR_setPosition(chimney->usedSprite, screenX, chimney->y);
-        }
-
-        if (chimney->prohibited) {
-            if (chimney->blockedSprite) {
-                SPR_setVisibility(chimney->blockedSprite, visible ? VISIBLE : HIDDEN);
-            }
-            if (chimney->sprite) {
-                SPR_setVisibility(chimney->sprite, HIDDEN);
-            }
-            if (chimney->usedSprite) {
-                SPR_setVisibility(chimney->usedSprite, HIDDEN);
-            }
-            continue;
+            gameCore_sprSetPosition(chimney->sprite, chimney->x, chimney->y);
+            gameCore_sprSetVisibility(chimney->sprite, visible ? VISIBLE : HIDDEN);
         }
+    }
+}
 
-        if (chimney->state == CHIMNEY_COOLDOWN) {
-            /* Mantener visible durante cooldown para que no desaparezca. */
-            if (chimney->usedSprite) {
-                SPR_setVisibility(chimney->usedSprite, visible ? VISIBLE : HIDDEN);
-                if (chimney->sprite) {
-                    SPR_setVisibility(chimney->sprite, HIDDEN);
-                }
-            } else if (chimney->sprite) {
-                SPR_setVisibility(chimney->sprite, visible ? VISIBLE : HIDDEN);
-            }
-            if (chimney->blockedSprite) {
-                SPR_setVisibility(chimney->blockedSprite, HIDDEN);
-            }
-        } else {
-            if (chimney->sprite) {
-                SPR_setVisibility(chimney->sprite, visible ? VISIBLE : HIDDEN);
-            }
-            if (chimney->blockedSprite) {
-                SPR_setVisibility(chimney->blockedSprite, HIDDEN);
-            }
-            if (chimney->usedSprite) {
-                SPR_setVisibility(chimney->usedSprite, HIDDEN);
-            }
-        }
+/**
+ * @brief Cambia la animación del sprite solo si cambió el aspecto.
+ *
+ * Prohibida manda sobre utilizada (en enfriamiento la chimenea no alterna).
+ * Los tres aspectos comparten hoja y tamaño, así que el cambio no toca la VRAM
+ * reservada; SPR_setAnim vuelve al primer frame, y la utilizada arranca su
+ * ciclo desde el principio.
+ */
+static void applyChimneyLook(Chimney* chimney) {
+    u8 look = CHIMNEY_LOOK_NORMAL;
+    if (chimney->prohibited) {
+        look = CHIMNEY_LOOK_PROHIBITED;
+    } else if (chimney->state == CHIMNEY_COOLDOWN) {
+        look = CHIMNEY_LOOK_USED;
     }
+    if (look == chimney->look || chimney->sprite == NULL) return;
+
+    chimney->look = look;
+    gameCore_sprSetAnim(chimney->sprite, look);
 }
 
 static void respawnEnemyFromTop(Enemy* enemy, u8 offsetIndex) {
     if (enemy == NULL) return;
 
-    enemy->x = random() % (WORLD_WIDTH - ENEMY_WIDTH);
+    enemy->x = gameCore_randomRange(GAME_RNG_DELIVERY, WORLD_WIDTH - ENEMY_WIDTH);
     enemy->y = -(ENEMY_HEIGHT + (offsetIndex * 20));
     enemy->vx = 0;
     enemy->vy = ENEMY_SPEED;
@@ -741,9 +776,9 @@ static void respawnEnemyFromTop(Enemy* enemy, u8 offsetIndex) {
     enemy->directionTimer = rollEnemyDirectionTimer();
 
     if (enemy->sprite) {
-        SPR_setPosition(enemy->sprite, enemy->x, enemy->y);
-        SPR_setVisibility(enemy->sprite, HIDDEN);
-        SPR_setAnim(enemy->sprite, 0);
+        gameCore_sprSetPosition(enemy->sprite, enemy->x, enemy->y);
+        gameCore_sprSetVisibility(enemy->sprite, HIDDEN);
+        gameCore_sprSetAnim(enemy->sprite, 0);
         SPR_setAnimationLoop(enemy->sprite, TRUE);
         SPR_setAutoAnimation(enemy->sprite, TRUE);
     }
@@ -752,26 +787,11 @@ static void respawnEnemyFromTop(Enemy* enemy, u8 offsetIndex) {
 }
 
 static void updateEnemies(s16 scrollStep) {
-    s16 targetX = 0;
-    s16 targetY = 0;
-    const u8 hasGiftTarget = getActiveGiftTargetPos(&targetX, &targetY);
-    s8 nearestIndex = -1;
-    if (hasGiftTarget) {
-        u32 bestDist = 0xFFFFFFFF;
-        for (u8 i = 0; i < MAX_ENEMIES; i++) {
-            Enemy* enemy = &enemies[i];
-            if (!enemy->active || enemy->sprite == NULL) continue;
-            const s16 enemyCenterX = enemy->x + (ENEMY_WIDTH / 2);
-            const s16 enemyCenterY = enemy->y + (ENEMY_HEIGHT / 2);
-            const s32 dx = (s32)enemyCenterX - (s32)targetX;
-            const s32 dy = (s32)enemyCenterY - (s32)targetY;
-            const u32 dist = (u32)(dx * dx + dy * dy);
-            if (dist < bestDist) {
-                bestDist = dist;
-                nearestIndex = (s8)i;
-            }
-        }
-    }
+    const u16 aiTurn = gameCore_aiSlicerNext(&enemyAi);
+    updateGiftTarget(aiTurn);
+    const u8 hasGiftTarget = (giftTarget.chaser >= 0);
+    const s16 targetX = giftTarget.x;
+    const s16 targetY = giftTarget.y;
 
     for (u8 i = 0; i < MAX_ENEMIES; i++) {
         Enemy* enemy = &enemies[i];
@@ -783,25 +803,16 @@ static void updateEnemies(s16 scrollStep) {
         if (enemy->stealAnimTimer > 0) {
             enemy->stealAnimTimer--;
             if (enemy->stealAnimTimer == 0) {
-                SPR_setAnim(enemy->sprite, 0);
+                gameCore_sprSetAnim(enemy->sprite, 0);
                 SPR_setAnimationLoop(enemy->sprite, TRUE);
                 SPR_setAutoAnimation(enemy->sprite, TRUE);
-                /* Tras robar, vuelve a patrullar con velocidad base y direcci¢n aleatoria. */
-                s8 dirX = 0;
-                s8 dirY = 0;
-                do {
-                    dirX = (random() % 3) - 1;
-                    dirY = (random() % 3) - 1;
-                } while (dirX == 0 && dirY == 0);
-
-                enemy->vx = dirX * ENEMY_SPEED;
-                enemy->vy = dirY * ENEMY_SPEED;
-                enemy->directionTimer = rollEnemyDirectionTimer();
+                /* Tras robar, vuelve a patrullar: el rumbo nuevo se elige en su turno. */
+                enemy->directionTimer = 0;
                 resumePatrol = TRUE;
             }
         }
 
-        u8 chaseGift = hasGiftTarget && ((s8)i == nearestIndex);
+        u8 chaseGift = hasGiftTarget && ((s8)i == giftTarget.chaser);
         if (resumePatrol) {
             chaseGift = FALSE;
         }
@@ -827,18 +838,9 @@ static void updateEnemies(s16 scrollStep) {
             if (enemy->directionTimer > 0) {
                 enemy->directionTimer--;
             }
-            if (enemy->directionTimer == 0) {
-                /* Elegir nueva dirección aleatoria, evitando vector nulo. */
-                s8 dirX = 0;
-                s8 dirY = 0;
-                do {
-                    dirX = (random() % 3) - 1; /* -1, 0 o 1 */
-                    dirY = (random() % 3) - 1; /* -1, 0 o 1 */
-                } while (dirX == 0 && dirY == 0);
-
-                enemy->vx = dirX * ENEMY_SPEED;
-                enemy->vy = dirY * ENEMY_SPEED;
-                enemy->directionTimer = rollEnemyDirectionTimer();
+            /* Temporizador agotado: cambia de rumbo en cuanto le llegue el turno. */
+            if (enemy->directionTimer == 0 && (aiTurn & (1 << i))) {
+                rerollEnemyDirection(enemy);
             }
         }
 
@@ -874,13 +876,14 @@ static void updateEnemies(s16 scrollStep) {
         }
 
         const u8 visible = (enemy->y + ENEMY_HEIGHT > 0) && (enemy->y < SCREEN_HEIGHT);
-        SPR_setPosition(enemy->sprite, enemy->x, enemy->y);
-        SPR_setVisibility(enemy->sprite, visible ? VISIBLE : HIDDEN);
-        SPR_setHFlip(enemy->sprite, (enemy->fvx < 0));
+        gameCore_sprSetPosition(enemy->sprite, enemy->x, enemy->y);
+        gameCore_sprSetVisibility(enemy->sprite, visible ? VISIBLE : HIDDEN);
+        gameCore_sprSetHFlip(enemy->sprite, (enemy->fvx < 0));
     }
 }
 
 static u8 getTargetEnemyCount(void) {
+    if (stressMode) return MAX_ENEMIES;
     u8 count = 1;
     if (giftCounterValue >= 2) count++;
     if (giftCounterValue >= 4) count++;
@@ -900,12 +903,12 @@ static void updateEnemyActivation(void) {
             enemy->active = TRUE;
             respawnEnemyFromTop(enemy, i);
             if (enemy->sprite) {
-                SPR_setVisibility(enemy->sprite, VISIBLE);
+                gameCore_sprSetVisibility(enemy->sprite, VISIBLE);
             }
         } else if (!shouldBeActive && enemy->active) {
             enemy->active = FALSE;
             if (enemy->sprite) {
-                SPR_setVisibility(enemy->sprite, HIDDEN);
+                gameCore_sprSetVisibility(enemy->sprite, HIDDEN);
             }
         }
     }
@@ -915,40 +918,55 @@ static void deactivateGiftDrop(GiftDrop* drop) {
     drop->active = FALSE;
     drop->pending = FALSE;
     if (drop->sprite) {
-        SPR_setVisibility(drop->sprite, HIDDEN);
+        gameCore_sprSetVisibility(drop->sprite, HIDDEN);
     }
     if (drop->targetSprite) {
-        SPR_setVisibility(drop->targetSprite, HIDDEN);
+        gameCore_sprSetVisibility(drop->targetSprite, HIDDEN);
+    }
+}
+
+/**
+ * @brief Registra chimeneas y enemigos en la rejilla tras moverlos este frame.
+ *
+ * Las chimeneas se registran todas; quien consulta filtra por estado, porque
+ * una entrega puede cambiarlo a mitad de frame.
+ */
+static void registerCollisionGrid(void) {
+    gameCore_gridClear();
+    for (u8 i = 0; i < NUM_CHIMNEYS; i++) {
+        gameCore_gridAdd(chimneys[i].x + CHIMNEY_HITBOX_OFFSET_X, chimneys[i].y + CHIMNEY_HITBOX_OFFSET_Y,
+            CHIMNEY_HITBOX_WIDTH, CHIMNEY_HITBOX_HEIGHT, LAYER_CHIMNEY, i);
+    }
+    for (u8 i = 0; i < MAX_ENEMIES; i++) {
+        if (!enemies[i].active) continue;
+        gameCore_gridAdd(enemies[i].x + ENEMY_HITBOX_OFFSET_X, enemies[i].y + ENEMY_HITBOX_OFFSET_Y,
+            ENEMY_HITBOX_WIDTH, ENEMY_HITBOX_HEIGHT, LAYER_ENEMY, i);
     }
 }
 
 static u8 checkGiftEnemyCollision(GiftDrop* drop) {
     if (drop == NULL || !drop->active) return FALSE;
 
-    for (u8 i = 0; i < MAX_ENEMIES; i++) {
-        Enemy* enemy = &enemies[i];
-        if (!enemy->active) continue;
+    u8 hits[GRID_MAX_HITS];
+    const u8 hitCount = gameCore_gridQuery(drop->x + GIFT_HITBOX_OFFSET_X, drop->y + GIFT_HITBOX_OFFSET_Y,
+        GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT, LAYER_ENEMY, hits, GRID_MAX_HITS);
 
-        const s16 giftHitX = drop->x + GIFT_HITBOX_OFFSET_X;
-        const s16 giftHitY = drop->y + GIFT_HITBOX_OFFSET_Y;
-        const s16 enemyHitX = enemy->x + ENEMY_HITBOX_OFFSET_X;
-        const s16 enemyHitY = enemy->y + ENEMY_HITBOX_OFFSET_Y;
+    for (u8 h = 0; h < hitCount; h++) {
+        Enemy* enemy = &enemies[gameCore_gridGetEntry(hits[h])->id];
+        if (!enemy->active) continue;
 
-        if (gameCore_checkCollision(giftHitX, giftHitY, GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT,
-                enemyHitX, enemyHitY, ENEMY_HITBOX_WIDTH, ENEMY_HITBOX_HEIGHT)) {
-            // kprintf("[THROW] gift captured by enemy idx=%u at (%d,%d)", i, drop->x, drop->y);
-            playRandomElfStealSound();
-            enemy->stealAnimTimer = ENEMY_STEAL_ANIM_FRAMES;
-            if (enemy->sprite) {
-                SPR_setAnim(enemy->sprite, 1);
-                SPR_setAnimationLoop(enemy->sprite, FALSE);
-                SPR_setAutoAnimation(enemy->sprite, TRUE);
-            }
-            deactivateGiftDrop(drop);
-            /* Entregas robadas ya no afectan al contador. */
-            /* onGiftFailure(); */
-            return TRUE;
+        // kprintf("[THROW] gift captured by enemy at (%d,%d)", drop->x, drop->y);
+        playRandomElfStealSound();
+        enemy->stealAnimTimer = ENEMY_STEAL_ANIM_FRAMES;
+        if (enemy->sprite) {
+            gameCore_sprSetAnim(enemy->sprite, 1);
+            SPR_setAnimationLoop(enemy->sprite, FALSE);
+            SPR_setAutoAnimation(enemy->sprite, TRUE);
         }
+        deactivateGiftDrop(drop);
+        /* Entregas robadas ya no afectan al contador. */
+        /* onGiftFailure(); */
+        return TRUE;
     }
 
     return FALSE;
@@ -963,23 +981,18 @@ static void updateGiftDrops(s16 scrollStep) {
         if (scrollStep) {
             drop->targetY += scrollStep;
             if (drop->active) {
-                drop->fy += FIX16(scrollStep);
+                gameCore_lineShift(&drop->path, 0, scrollStep);
             }
         }
 
-        if (drop->active && drop->framesToTarget > 0) {
-            drop->framesToTarget--;
-        }
-
+        u8 arrived = FALSE;
         if (drop->active && drop->sprite) {
-            drop->fx += drop->vx;
-            drop->fy += drop->vy;
-
-            drop->x = F16_toInt(drop->fx);
-            drop->y = F16_toInt(drop->fy);
+            arrived = gameCore_lineStep(&drop->path);
+            drop->x = drop->path.x;
+            drop->y = drop->path.y;
 
-            SPR_setPosition(drop->sprite, drop->x, drop->y);
-            SPR_setVisibility(drop->sprite, VISIBLE);
+            gameCore_sprSetPosition(drop->sprite, drop->x, drop->y);
+            gameCore_sprSetVisibility(drop->sprite, VISIBLE);
 
             if (checkGiftEnemyCollision(drop)) {
                 continue;
@@ -990,29 +1003,38 @@ static void updateGiftDrops(s16 scrollStep) {
             const s16 markOffset = (GIFT_SIZE - TARGET_MARK_SIZE) / 2;
             const s16 targetMarkX = drop->targetX + markOffset;
             const s16 targetMarkY = drop->targetY + markOffset;
-            SPR_setDepth(drop->targetSprite, DEPTH_MARKERS);
-            SPR_setPosition(drop->targetSprite, targetMarkX, targetMarkY);
-            SPR_setVisibility(drop->targetSprite, VISIBLE);
+            gameCore_sprSetDepth(drop->targetSprite, DEPTH_MARKERS);
+            gameCore_sprSetPosition(drop->targetSprite, targetMarkX, targetMarkY);
+            gameCore_sprSetVisibility(drop->targetSprite, VISIBLE);
         }
 
         if (!drop->active) {
             continue;
         }
 
-        if (drop->active && drop->sprite) {
-            const u8 arrivedByFrames = (drop->framesToTarget == 0);
-            const u8 closeEnough = (abs16(drop->x - drop->targetX) <= 1) && (abs16(drop->y - drop->targetY) <= 1);
-            if (arrivedByFrames || closeEnough) {
-                drop->x = drop->targetX;
-                drop->y = drop->targetY;
-                drop->fx = FIX16(drop->x);
-                drop->fy = FIX16(drop->y);
-                SPR_setPosition(drop->sprite, drop->x, drop->y);
-                resolveGiftDropAtTarget(drop);
-                deactivateGiftDrop(drop);
-            }
+        /* El paso de Bresenham termina justo en el destino: no hace falta encajarlo. */
+        if (arrived) {
+            resolveGiftDropAtTarget(drop);
+            deactivateGiftDrop(drop);
+        }
+    }
+}
+
+/** @brief Ordena Santa, enemigos y regalos en vuelo por su base: el que está más abajo va delante. */
+static void reorderActorDepths(void) {
+    gameCore_depthBegin(&depthList);
+    gameCore_depthSubmit(&depthList, santa.sprite, santa.y + SANTA_HEIGHT);
+    for (u8 i = 0; i < MAX_ENEMIES; i++) {
+        if (enemies[i].active) {
+            gameCore_depthSubmit(&depthList, enemies[i].sprite, enemies[i].y + ENEMY_HEIGHT);
+        }
+    }
+    for (u8 i = 0; i < NUM_GIFT_DROPS; i++) {
+        if (drops[i].active) {
+            gameCore_depthSubmit(&depthList, drops[i].sprite, drops[i].y + GIFT_SIZE);
         }
     }
+    gameCore_depthCommit(&depthList);
 }
 
 static s16 abs16(s16 value) {
@@ -1039,30 +1061,97 @@ static u16 rollEnemyDirectionTimer(void) {
     const u16 minFrames = ENEMY_DIR_CHANGE_MIN_FRAMES;
     const u16 maxFrames = ENEMY_DIR_CHANGE_MAX_FRAMES;
     const u16 span = (maxFrames > minFrames) ? (maxFrames - minFrames) : 0;
-    const u16 randomOffset = span ? (random() % (span + 1)) : 0;
+    const u16 randomOffset = span ? gameCore_randomRange(GAME_RNG_DELIVERY, span + 1) : 0;
     return minFrames + randomOffset;
 }
 
-static u8 getActiveGiftTargetPos(s16* targetX, s16* targetY) {
-    if (targetX == NULL || targetY == NULL) return FALSE;
+/** @brief Elige un rumbo de patrulla aleatorio (nunca nulo) y rearma su temporizador. */
+static void rerollEnemyDirection(Enemy* enemy) {
+    s8 dirX = 0;
+    s8 dirY = 0;
+    do {
+        dirX = gameCore_randomRange(GAME_RNG_DELIVERY, 3) - 1; /* -1, 0 o 1 */
+        dirY = gameCore_randomRange(GAME_RNG_DELIVERY, 3) - 1; /* -1, 0 o 1 */
+    } while (dirX == 0 && dirY == 0);
+
+    enemy->vx = dirX * ENEMY_SPEED;
+    enemy->vy = dirY * ENEMY_SPEED;
+    enemy->directionTimer = rollEnemyDirectionTimer();
+}
 
-    for (u8 i = 0; i < NUM_GIFT_DROPS; i++) {
-        const GiftDrop* drop = &drops[i];
-        if (drop->active) {
-            *targetX = drop->x + (GIFT_SIZE / 2);
-            *targetY = drop->y + (GIFT_SIZE / 2);
-            return TRUE;
-        }
-        if (drop->pending) {
-            *targetX = drop->targetX + (GIFT_SIZE / 2);
-            *targetY = drop->targetY + (GIFT_SIZE / 2);
-            return TRUE;
-        }
-    }
+/** @brief Distancia al cuadrado del centro del enemigo al objetivo. */
+static u32 enemyDistanceSq(const Enemy* enemy, s16 targetX, s16 targetY) {
+    const s32 dx = (s32)(enemy->x + (ENEMY_WIDTH / 2)) - (s32)targetX;
+    const s32 dy = (s32)(enemy->y + (ENEMY_HEIGHT / 2)) - (s32)targetY;
+    return (u32)(dx * dx + dy * dy);
+}
 
+/**
+ * @brief Centro al que apuntan los enemigos para un regalo.
+ * @return FALSE si el slot está libre. Un regalo en vuelo da su posición
+ *         viva; uno pendiente de lanzar, su punto de llegada.
+ */
+static u8 getGiftDropThreatPos(const GiftDrop* drop, s16* x, s16* y) {
+    if (drop->active) {
+        *x = drop->x + (GIFT_SIZE / 2);
+        *y = drop->y + (GIFT_SIZE / 2);
+        return TRUE;
+    }
+    if (drop->pending) {
+        *x = drop->targetX + (GIFT_SIZE / 2);
+        *y = drop->targetY + (GIFT_SIZE / 2);
+        return TRUE;
+    }
     return FALSE;
 }
 
+/**
+ * @brief Elige el regalo más amenazado (el que tiene un enemigo más cerca) y su perseguidor.
+ *
+ * Vecino más cercano incremental: la pareja del frame anterior se conserva y
+ * solo le disputan el puesto los enemigos con turno de IA, contra todos los
+ * regalos. Solo si el regalo o el perseguidor desaparecen se rehace la
+ * búsqueda con todos los enemigos.
+ *
+ * @param aiTurn Enemigos con turno este frame (gameCore_aiSlicerNext).
+ */
+static void updateGiftTarget(u16 aiTurn) {
+    GiftTarget* target = &giftTarget;
+    u16 candidates = aiTurn;
+    u32 bestDist = 0xFFFFFFFF;
+
+    const u8 keep = (target->drop >= 0) && (target->chaser >= 0) &&
+        enemies[target->chaser].active && (enemies[target->chaser].sprite != NULL) &&
+        getGiftDropThreatPos(&drops[target->drop], &target->x, &target->y);
+    if (keep) {
+        bestDist = enemyDistanceSq(&enemies[target->chaser], target->x, target->y);
+    } else {
+        target->drop = -1;
+        target->chaser = -1;
+        candidates = (u16)((1 << MAX_ENEMIES) - 1);
+    }
+
+    for (u8 d = 0; d < NUM_GIFT_DROPS; d++) {
+        s16 dropX;
+        s16 dropY;
+        if (!getGiftDropThreatPos(&drops[d], &dropX, &dropY)) continue;
+        u16 turn = candidates;
+        while (turn) {
+            const u8 i = gameCore_poolNextSlot(&turn);
+            const Enemy* enemy = &enemies[i];
+            if (!enemy->active || enemy->sprite == NULL) continue;
+            const u32 dist = enemyDistanceSq(enemy, dropX, dropY);
+            if (dist < bestDist) {
+                bestDist = dist;
+                target->drop = (s8)d;
+                target->chaser = (s8)i;
+                target->x = dropX;
+                target->y = dropY;
+            }
+        }
+    }
+}
+
 static void onGiftSuccess(void) {
     const u8 previousValue = giftCounterValue;
     if (giftCounterValue < DELIVERY_TARGET) {
@@ -1079,7 +1168,7 @@ static void onGiftSuccess(void) {
 }
 
 static void playRandomElfStealSound(void) {
-    if (random() & 1) {
+    if (gameCore_random(GAME_RNG_DELIVERY) & 1) {
         XGM2_playPCM(snd_elfo_volador_robando_1, sizeof(snd_elfo_volador_robando_1), SOUND_PCM_CH_AUTO);
     } else {
         XGM2_playPCM(snd_elfo_volador_robando_2, sizeof(snd_elfo_volador_robando_2), SOUND_PCM_CH_AUTO);
@@ -1095,39 +1184,26 @@ static void playGiftLostSound(void) {
 }
 
 static Chimney* findChimneyAtPoint(s16 x, s16 y) {
-    for (u8 i = 0; i < NUM_CHIMNEYS; i++) {
-        Chimney* chimney = &chimneys[i];
-        if (chimney->prohibited || chimney->state != CHIMNEY_ACTIVE) continue;
+    u8 hits[GRID_MAX_HITS];
+    const u8 hitCount = gameCore_gridQuery(x + GIFT_HITBOX_OFFSET_X, y + GIFT_HITBOX_OFFSET_Y,
+        GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT, LAYER_CHIMNEY, hits, GRID_MAX_HITS);
 
-        const s16 giftHitX = x + GIFT_HITBOX_OFFSET_X;
-        const s16 giftHitY = y + GIFT_HITBOX_OFFSET_Y;
-        const s16 chimneyHitX = chimney->x + CHIMNEY_HITBOX_OFFSET_X;
-        const s16 chimneyHitY = chimney->y + CHIMNEY_HITBOX_OFFSET_Y;
-
-        if (gameCore_checkCollision(giftHitX, giftHitY, GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT,
-                chimneyHitX, chimneyHitY, CHIMNEY_HITBOX_WIDTH, CHIMNEY_HITBOX_HEIGHT)) {
-            return chimney;
-        }
+    for (u8 h = 0; h < hitCount; h++) {
+        Chimney* chimney = &chimneys[gameCore_gridGetEntry(hits[h])->id];
+        if (chimney->prohibited || chimney->state != CHIMNEY_ACTIVE) continue;
+        return chimney;
     }
 
     return NULL;
 }
 
 static Chimney* findAnyChimneyAtPoint(s16 x, s16 y) {
-    for (u8 i = 0; i < NUM_CHIMNEYS; i++) {
-        Chimney* chimney = &chimneys[i];
-        const s16 giftHitX = x + GIFT_HITBOX_OFFSET_X;
-        const s16 giftHitY = y + GIFT_HITBOX_OFFSET_Y;
-        const s16 chimneyHitX = chimney->x + CHIMNEY_HITBOX_OFFSET_X;
-        const s16 chimneyHitY = chimney->y + CHIMNEY_HITBOX_OFFSET_Y;
-
-        if (gameCore_checkCollision(giftHitX, giftHitY, GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT,
-                chimneyHitX, chimneyHitY, CHIMNEY_HITBOX_WIDTH, CHIMNEY_HITBOX_HEIGHT)) {
-            return chimney;
-        }
+    u8 hit;
+    if (gameCore_gridQuery(x + GIFT_HITBOX_OFFSET_X, y + GIFT_HITBOX_OFFSET_Y,
+            GIFT_HITBOX_WIDTH, GIFT_HITBOX_HEIGHT, LAYER_CHIMNEY, &hit, 1) == 0) {
+        return NULL;
     }
-
-    return NULL;
+    return &chimneys[gameCore_gridGetEntry(hit)->id];
 }
 
 static void resolveGiftDropAtTarget(const GiftDrop* drop) {
@@ -1152,16 +1228,7 @@ static void resolveGiftDropAtTarget(const GiftDrop* drop) {
     chimney->state = CHIMNEY_COOLDOWN;
     chimney->cooldown = CHIMNEY_RESET_FRAMES;
     chimney->blink = 0;
-    if (chimney->usedSprite) {
-        SPR_setAnim(chimney->usedSprite, 0);
-        SPR_setAnimationLoop(chimney->usedSprite, TRUE);
-        SPR_setAutoAnimation(chimney->usedSprite, TRUE);
-        SPR_setPosition(chimney->usedSprite, chimney->x, chimney->y);
-        SPR_setVisibility(chimney->usedSprite, VISIBLE);
-        if (chimney->sprite) {
-            SPR_setVisibility(chimney->sprite, HIDDEN);
-        }
-    }
+    applyChimneyLook(chimney);
 
     onGiftSuccess();
     // kprintf("[THROW] gift delivered at chimney x=%d y=%d deliveries=%u giftsLeft=%u",
@@ -1188,39 +1255,25 @@ static void spawnGiftDrop(void) {
         if (drop->sprite == NULL) {
             drop->pending = FALSE;
             if (drop->targetSprite) {
-                SPR_setVisibility(drop->targetSprite, HIDDEN);
+                gameCore_sprSetVisibility(drop->targetSprite, HIDDEN);
             }
             return;
         }
-        SPR_setDepth(drop->sprite, DEPTH_EFFECTS);
+        gameCore_sprSetDepth(drop->sprite, DEPTH_EFFECTS);
         SPR_setAutoAnimation(drop->sprite, FALSE);
-        SPR_setAnim(drop->sprite, 0);
+        gameCore_sprSetAnim(drop->sprite, 0);
     }
 
     drop->active = TRUE;
     drop->pending = FALSE;
     drop->x = santa.x + SANTA_THROW_OFFSET_X;
     drop->y = santa.y + SANTA_THROW_OFFSET_Y;
-    drop->fx = FIX16(drop->x);
-    drop->fy = FIX16(drop->y);
-    const s16 dx = drop->targetX - drop->x;
-    const s16 dy = drop->targetY - drop->y;
-    const s16 absDx = (dx < 0) ? -dx : dx;
-    const s16 absDy = (dy < 0) ? -dy : dy;
-    u16 travelFrames = (absDx > absDy) ? absDx : absDy;
-    travelFrames = (travelFrames / GIFT_FLY_SPEED);
-    if (travelFrames == 0) {
-        travelFrames = 1;
-    }
-    drop->framesToTarget = travelFrames;
-    drop->vx = F16_div(FIX16(dx), FIX16(travelFrames));
-    drop->vy = F16_div(FIX16(dy), FIX16(travelFrames));
-    SPR_setPosition(drop->sprite, drop->x, drop->y);
-    SPR_setVisibility(drop->sprite, VISIBLE);
-
-    // kprintf("[THROW] spawn gift pos=(%d,%d) target=(%d,%d) frames=%u vx=%ld vy=%ld",
-    //     drop->x, drop->y, drop->targetX, drop->targetY,
-    //     travelFrames, (long)drop->vx, (long)drop->vy);
+    gameCore_lineInit(&drop->path, drop->x, drop->y, drop->targetX, drop->targetY, GIFT_FLY_SPEED);
+    gameCore_sprSetPosition(drop->sprite, drop->x, drop->y);
+    gameCore_sprSetVisibility(drop->sprite, VISIBLE);
+
+    // kprintf("[THROW] spawn gift pos=(%d,%d) target=(%d,%d) steps=%u",
+    //     drop->x, drop->y, drop->targetX, drop->targetY, drop->path.major);
 }
 
 static Chimney* findNearestChimneyInRange(s16 centerX, s16 centerY, u16 radius, s32* outDistanceSq) {
@@ -1269,11 +1322,6 @@ static void startGiftThrow(void) {
     GiftDrop* pendingDrop = &drops[(u8)pendingIndex];
     pendingDrop->pending = TRUE;
     pendingDrop->active = FALSE;
-    pendingDrop->framesToTarget = 0;
-    pendingDrop->vx = FIX16(0);
-    pendingDrop->vy = FIX16(0);
-    pendingDrop->fx = FIX16(0);
-    pendingDrop->fy = FIX16(0);
 
     const s16 santaThrowX = santa.x + SANTA_THROW_OFFSET_X;
     const s16 santaThrowY = santa.y + SANTA_THROW_OFFSET_Y;
@@ -1281,7 +1329,7 @@ static void startGiftThrow(void) {
     Chimney* nearest = findNearestChimneyInRange(santaThrowX, santaThrowY,
         THROW_TARGET_RADIUS, &distanceSq);
 
-    const s16 fallbackSide = (random() & 1) ? THROW_FALLBACK_OFFSET_X : -THROW_FALLBACK_OFFSET_X;
+    const s16 fallbackSide = (gameCore_random(GAME_RNG_DELIVERY) & 1) ? THROW_FALLBACK_OFFSET_X : -THROW_FALLBACK_OFFSET_X;
     s16 targetCenterX = santaThrowX + fallbackSide;
     s16 targetCenterY = santaThrowY;
     if (nearest != NULL) {
@@ -1303,9 +1351,9 @@ static void startGiftThrow(void) {
             TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
     }
     if (pendingDrop->targetSprite) {
-        SPR_setDepth(pendingDrop->targetSprite, DEPTH_MARKERS);
-        SPR_setPosition(pendingDrop->targetSprite, targetMarkX, targetMarkY);
-        SPR_setVisibility(pendingDrop->targetSprite, VISIBLE);
+        gameCore_sprSetDepth(pendingDrop->targetSprite, DEPTH_MARKERS);
+        gameCore_sprSetPosition(pendingDrop->targetSprite, targetMarkX, targetMarkY);
+        gameCore_sprSetVisibility(pendingDrop->targetSprite, VISIBLE);
     }
     // kprintf("[THROW] lock target idx=%d target=(%d,%d)", pendingIndex, pendingDrop->targetX, pendingDrop->targetY);
 
@@ -1316,7 +1364,7 @@ static void startGiftThrow(void) {
     // kprintf("[THROW] start cooldown=%d", dropCooldown);
 
     if (santa.sprite) {
-        SPR_setAnim(santa.sprite, 1);
+        gameCore_sprSetAnim(santa.sprite, 1);
         SPR_setAnimationLoop(santa.sprite, FALSE);
         SPR_setAutoAnimation(santa.sprite, TRUE);
     }
@@ -1330,7 +1378,7 @@ static void updateSantaThrowState(void) {
         santaThrowGiftSpawned = FALSE;
         santaReturnToIdle = FALSE;
         if (santa.sprite) {
-            SPR_setAnim(santa.sprite, 0);
+            gameCore_sprSetAnim(santa.sprite, 0);
             SPR_setAnimationLoop(santa.sprite, TRUE);
             SPR_setAutoAnimation(santa.sprite, TRUE);
             // kprintf("[THROW] Santa back to idle");
@@ -1366,18 +1414,10 @@ static void checkEnemyCollision(void) {
     s16 santaHitX = santa.x + ((SANTA_WIDTH - SANTA_HITBOX_WIDTH) / 2);
     s16 santaHitY = santa.y + (SANTA_HEIGHT - SANTA_HITBOX_HEIGHT);
 
-    for (u8 i = 0; i < MAX_ENEMIES; i++) {
-        Enemy* enemy = &enemies[i];
-        if (!enemy->active) continue;
-
-        const s16 enemyHitX = enemy->x + ENEMY_HITBOX_OFFSET_X;
-        const s16 enemyHitY = enemy->y + ENEMY_HITBOX_OFFSET_Y;
-
-        if (gameCore_checkCollision(santaHitX, santaHitY, SANTA_HITBOX_WIDTH, SANTA_HITBOX_HEIGHT,
-                enemyHitX, enemyHitY, ENEMY_HITBOX_WIDTH, ENEMY_HITBOX_HEIGHT)) {
-            startRecovery();
-            break;
-        }
+    u8 hit;
+    if (gameCore_gridQuery(santaHitX, santaHitY, SANTA_HITBOX_WIDTH, SANTA_HITBOX_HEIGHT,
+            LAYER_ENEMY, &hit, 1)) {
+        startRecovery();
     }
 }
 
@@ -1392,11 +1432,11 @@ static void startRecovery(void) {
     santa.vx = 0;
     santa.vy = 0;
     if (santa.sprite) {
-        SPR_setAnim(santa.sprite, 0);
+        gameCore_sprSetAnim(santa.sprite, 0);
         SPR_setAnimationLoop(santa.sprite, TRUE);
         SPR_setAutoAnimation(santa.sprite, TRUE);
     }
-    SPR_setPosition(santa.sprite, santa.x, santa.y);
+    gameCore_sprSetPosition(santa.sprite, santa.x, santa.y);
 }
 
 static void updateRecovery(void) {
@@ -1405,13 +1445,13 @@ static void updateRecovery(void) {
     recoveringFrames--;
     if (santa.sprite) {
         if ((recoveringFrames % 8) == 0) {
-            SPR_setVisibility(santa.sprite, HIDDEN);
+            gameCore_sprSetVisibility(santa.sprite, HIDDEN);
         } else if ((recoveringFrames % 4) == 0) {
-            SPR_setVisibility(santa.sprite, VISIBLE);
+            gameCore_sprSetVisibility(santa.sprite, VISIBLE);
         }
     }
 
     if (recoveringFrames == 0 && santa.sprite) {
-        SPR_setVisibility(santa.sprite, VISIBLE);
+        gameCore_sprSetVisibility(santa.sprite, VISIBLE);
     }
 }
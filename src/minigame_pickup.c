@@ -6,8 +6,8 @@
  * Estado actual: mecanicas acotadas; falta disparo especial definitivo y sprite de regalo lateral.
  *
  * Recursos y paletas usados en la fase:
- * - Fondos: `resources_bg.h` aporta el `mapTrack` y su paleta de nieve aplicada
- *   al plano B con el índice `globalTileIndex` como base de carga.
+ * - Fondos: `resources_bg.h` aporta la pista (`trackPlane`, volcada entera
+ *   al plano B con `gameCore_loopPlaneInit`) y su paleta de nieve, en la región de VRAM "pista_polo" (`gameCore_vramAlloc`).
  * - Sprites: definidos en `resources_sprites.h` para Santa, árboles, elfos y
  *   regalos. Cada sprite usa su propia paleta incluida en el mismo fichero.
  * - Efectos de sonido: `resources_sfx.h` (aterrizaje de regalos, colisiones y
@@ -28,6 +28,7 @@
 #include "resources_sfx.h"
 #include "snow_effect.h"
 #include "gift_counter.h"
+#include "game_luts.h"
 
 static void traceFunc(const char *funcName);
 #define TRACE_FUNC() traceFunc(__func__)
@@ -41,9 +42,11 @@ static void traceFunc(const char *funcName);
 #define SCROLL_SPEED 1           /* Velocidad base de scroll vertical. */
 #define FORBIDDEN_PERCENT 10     /* Margen lateral no jugable (porcentaje). */
 #define TRACK_LOOP_PX 512        /* Altura del bucle de pista. */
+#define TRACK_WIDTH_PX 320       /* Ancho del mapa de la pista. */
 
 #define ENEMY_LATERAL_DELAY 10   /* Retardo entre ajustes laterales del enemigo. */
 #define ENEMY_LATERAL_SPEED 1    /* Velocidad lateral del enemigo. */
+#define ENEMY_AI_PER_FRAME 1     /* Enemigos que revisan su rumbo lateral cada frame. */
 #define ENEMY_ESCAPE_SPEED 3     /* Velocidad de escape tras robar. */
 
 #define TREE_SIZE 64             /* Tamaño de sprite del árbol. */
@@ -89,13 +92,47 @@ static void traceFunc(const char *funcName);
 #define TREE_COLLISION_BLINK_FRAMES 120 /* Duración del parpadeo tras choque. */
 #define TREE_COLLISION_BLINK_INTERVAL_FRAMES 6 /* Intervalo de parpadeo. */
 #define GIFT_COUNTER_BLINK_INTERVAL_FRAMES 3 /* Intervalo de parpadeo del HUD. */
+#define LAYER_TREE 0x01             /* Capa de rejilla: árboles. */
+#define LAYER_ENEMY 0x02            /* Capa de rejilla: duendes rojos. */
+#define LAYER_GIFT 0x04             /* Capa de rejilla: regalos de elfos en zona de recogida. */
+#define GRID_MAX_HITS (NUM_TREES + NUM_ELVES + NUM_ENEMIES) /* Impactos que devuelve cada consulta. */
+#define ACTOR_POOL_SLOTS NUM_ELVES  /* Capacidad de los pools de actores (el grupo más grande). */
 
-/** @brief Actor básico con sprite y coordenadas. */
+/**
+ * @brief Grupo de actores simples guardado como estructura de arrays.
+ *
+ * El pool de game_core decide qué slots están vivos; sprite y posición se
+ * indexan por slot. Los recorridos por frame solo visitan los slots vivos.
+ */
 typedef struct {
-    Sprite* sprite;
-    s16 x, y;
-    u8 active;
-} SimpleActor;
+    GameEntityPool pool;               /**< Slots vivos y lista libre. */
+    Sprite* sprite[ACTOR_POOL_SLOTS];  /**< Sprite de cada slot (se conserva al liberar). */
+    s16 x[ACTOR_POOL_SLOTS];           /**< Posición X en pantalla. */
+    s16 y[ACTOR_POOL_SLOTS];           /**< Posición Y en pantalla. */
+} ActorPool;
+
+/** @brief Componentes propios de cada elfo (marca, sombra y regalo), indexados por slot. */
+typedef struct {
+    s16 spawnY[NUM_ELVES];             /**< Puntos de aparición vertical de elfos. */
+    u8 side[NUM_ELVES];                /**< Lado del camino donde aparece cada elfo. */
+    u16 respawnTimer[NUM_ELVES];       /**< Temporizador de reaparición (solo slots libres). */
+    u8 markShown[NUM_ELVES];           /**< Indicador de X mostrado sobre cada elfo. */
+    Sprite* markSprite[NUM_ELVES];     /**< Sprites de las marcas flotantes. */
+    s16 markX[NUM_ELVES];              /**< Posición X del indicador de elfo. */
+    s16 markY[NUM_ELVES];              /**< Posición Y del indicador de elfo. */
+    Sprite* shadowSprite[NUM_ELVES];   /**< Sprites de sombra de los elfos. */
+    s16 shadowStartX[NUM_ELVES];       /**< Punto inicial X para desplazar sombras. */
+    s16 shadowStartY[NUM_ELVES];       /**< Punto inicial Y para desplazar sombras. */
+    u8 shadowActive[NUM_ELVES];        /**< Estado visible/activo de cada sombra. */
+    s16 shadowX[NUM_ELVES];            /**< Posición X actual de la sombra. */
+    s16 shadowY[NUM_ELVES];            /**< Posición Y actual de la sombra. */
+    Sprite* giftSprite[NUM_ELVES];     /**< Sprites de regalo lanzado a elfos. */
+    u8 giftActive[NUM_ELVES];          /**< Si el regalo está volando hacia el elfo. */
+    u8 giftLanded[NUM_ELVES];          /**< Si el regalo ya aterrizó junto al elfo. */
+    s16 giftX[NUM_ELVES];              /**< Posición X del regalo en vuelo. */
+    s16 giftY[NUM_ELVES];              /**< Posición Y del regalo en vuelo. */
+    GameLineStepper giftPath[NUM_ELVES]; /**< Recorrido en el suelo del regalo (sin el arco). */
+} ElfComponents;
 
 /** @brief Datos principales del trineo de Santa. */
 typedef struct {
@@ -107,28 +144,12 @@ typedef struct {
 } Santa;
 
 static Santa santa; /**< Estado del sprite controlable de Santa. */
-static SimpleActor trees[NUM_TREES]; /**< Obstáculos de árboles en pista. */
-static SimpleActor elves[NUM_ELVES]; /**< Peatones que reciben regalos. */
-static SimpleActor enemies[NUM_ENEMIES]; /**< Enemigos que roban regalos. */
-static s16 elfSpawnY[NUM_ELVES]; /**< Puntos de aparición vertical de elfos. */
-static u8 elfMarkShown[NUM_ELVES]; /**< Indicador de X mostrado sobre cada elfo. */
-static Sprite* elfMarkSprites[NUM_ELVES]; /**< Sprites de las marcas flotantes. */
-static s16 elfMarkPosX[NUM_ELVES]; /**< Posición X del indicador de elfo. */
-static s16 elfMarkPosY[NUM_ELVES]; /**< Posición Y del indicador de elfo. */
-static Sprite* elfShadowSprites[NUM_ELVES]; /**< Sprites de sombra de los elfos. */
-static s16 elfShadowStartX[NUM_ELVES]; /**< Punto inicial X para desplazar sombras. */
-static s16 elfShadowStartY[NUM_ELVES]; /**< Punto inicial Y para desplazar sombras. */
-static u8 elfShadowActive[NUM_ELVES]; /**< Estado visible/activo de cada sombra. */
-static s16 elfShadowPosX[NUM_ELVES]; /**< Posición X actual de la sombra. */
-static s16 elfShadowPosY[NUM_ELVES]; /**< Posición Y actual de la sombra. */
-static Sprite* elfGiftSprites[NUM_ELVES]; /**< Sprites de regalo lanzado a elfos. */
-static u8 elfGiftActive[NUM_ELVES]; /**< Si el regalo está volando hacia el elfo. */
-static u8 elfGiftHasLanded[NUM_ELVES]; /**< Si el regalo ya aterrizó junto al elfo. */
-static s16 elfGiftPosX[NUM_ELVES]; /**< Posición X del regalo en vuelo. */
-static s16 elfGiftPosY[NUM_ELVES]; /**< Posición Y del regalo en vuelo. */
-static u16 elfRespawnTimer[NUM_ELVES]; /**< Temporizador de reaparición por elfo. */
-static u8 elfSide[NUM_ELVES]; /**< Lado del camino donde aparece cada elfo. */
-static Map *mapTrack; /**< Mapa de la pista nevosa en BG. */
+static ActorPool trees; /**< Obstáculos de árboles en pista. */
+static ActorPool elves; /**< Peatones que reciben regalos. */
+static ActorPool enemies; /**< Enemigos que roban regalos. */
+static ElfComponents elf; /**< Marca, sombra y regalo de cada elfo. */
+static GameDepthList depthList; /**< Orden de profundidad de Santa, actores y regalos. */
+static GameLoopPlane trackPlane; /**< Pista nevosa en bucle sobre BG_B. */
 static s16 trackOffsetY; /**< Desfase vertical acumulado del scroll. */
 static fix16 scrollSpeedPerFrame; /**< Velocidad actual de scroll en fix16. */
 static fix16 scrollAccumulator; /**< Acumulador de scroll fraccional. */
@@ -160,13 +181,19 @@ static const char* lastTraceFunc = NULL; /**< Última función trazada. */
 static u8 recoveringFromTree; /**< Flag de recuperación tras chocar con árbol. */
 static u16 treeCollisionBlinkFrames; /**< Duración del parpadeo de colisión. */
 static u8 treeCollisionVisible; /**< Controla la visibilidad durante parpadeo. */
-static SimpleActor* collidedTree; /**< Referencia al árbol con el que chocó Santa. */
+static u8 collidedTree; /**< Slot del árbol con el que chocó Santa (GAME_POOL_NONE si ninguno). */
 static u8 enemyStealActive; /**< Secuencia de robo de regalo en curso. */
 static u8 enemyStealIndex; /**< Índice del enemigo que roba. */
 static s16 enemyEscapeTargetX; /**< Destino X del enemigo al huir. */
 static s16 enemyEscapeTargetY; /**< Destino Y del enemigo al huir. */
 static u8 activeEnemyCount;  /**< Número actual de enemigos activos (empieza en 1). */
+static GameAiSlicer enemyAi; /**< Turnos de decisión de los enemigos. */
+static s8 enemyLateralDir[NUM_ENEMIES]; /**< Rumbo lateral decidido en el último turno (-1, 0, 1). */
 static u8 secondTreeSpawned; /**< TRUE cuando el segundo árbol ya está activo. */
+static u8 qualitySnow; /**< Efecto opcional: animación de la nieve. */
+static u8 qualityShadows; /**< Efecto opcional: recorrido de las sombras de los elfos. */
+static u8 qualityHudBlink; /**< Efecto opcional: refresco del HUD cada frame. */
+static u8 qualityDepth; /**< Efecto opcional: reordenado de profundidad. */
 
 /**
  * @brief Traza cambios de función para depuración ligera.
@@ -183,18 +210,19 @@ static void traceFunc(const char *funcName) {
 }
 
 static void collectGift(void);
+static void collectElfGift(u8 index);
 static void updateGiftCounter(void);
-static void beginTreeCollision(SimpleActor *tree);
+static void beginTreeCollision(u8 tree);
 static void updateTreeCollisionRecovery(void);
 static void endTreeCollisionRecovery(void);
-static void selectEnemyEscapeTarget(SimpleActor *enemy, s16 *targetX, s16 *targetY);
+static void selectEnemyEscapeTarget(u8 enemy, s16 *targetX, s16 *targetY);
 static void beginEnemyStealSequence(u8 enemyIndex);
 static void updateEnemyStealSequence(void);
 static void endEnemyStealSequence(void);
 static void startMusicAfterHoHoHo(void);
 static void clearEnemiesOnTreeCollision(void);
 static void clearElvesOnTreeCollision(void);
-static void clearOtherTreesOnCollision(const SimpleActor *treeToKeep);
+static void clearOtherTreesOnCollision(u8 treeToKeep);
 static void pauseSantaAnimation(void);
 static void resumeSantaAnimation(void);
 static u16 giftsLossFloor(void);
@@ -217,32 +245,34 @@ static u8 validateHorizontalRange(s16 minX, s16 maxX, const char* context) {
 }
 
 /**
- * @brief Desactiva un actor y oculta su sprite reportando el contexto.
- * @param actor Actor a desactivar.
+ * @brief Libera el slot de un actor y oculta su sprite reportando el contexto.
+ * @param group Grupo al que pertenece el actor.
+ * @param slot Slot a liberar.
  * @param context Etiqueta para trazas.
  */
-static void markActorInactive(SimpleActor *actor, const char* context) {
+static void markActorInactive(ActorPool *group, u8 slot, const char* context) {
     TRACE_FUNC();
-    actor->active = FALSE;
+    gameCore_poolRelease(&group->pool, slot);
     // kprintf("[%s] Actor desactivado por error de inicializacion", context);
-    if (actor->sprite != NULL) {
-        SPR_setVisibility(actor->sprite, HIDDEN);
+    if (group->sprite[slot] != NULL) {
+        gameCore_sprSetVisibility(group->sprite[slot], HIDDEN);
     }
 }
 
 /**
- * @brief Sitúa un actor en una posición aleatoria dentro de un rango.
- * @param actor Actor a posicionar.
+ * @brief Sitúa un actor en una posición aleatoria dentro de un rango y lo marca vivo.
+ * @param group Grupo al que pertenece el actor.
+ * @param slot Slot del actor.
  * @param minX Límite izquierdo.
  * @param maxX Límite derecho.
  * @param minY Límite superior.
  * @param maxY Límite inferior.
  */
-static void placeActor(SimpleActor *actor, s16 minX, s16 maxX, s16 minY, s16 maxY) {
+static void placeActor(ActorPool *group, u8 slot, s16 minX, s16 maxX, s16 minY, s16 maxY) {
     TRACE_FUNC();
-    actor->x = minX + (random() % (maxX - minX));
-    actor->y = -((random() % (maxY - minY)) + minY);
-    actor->active = TRUE;
+    group->x[slot] = minX + gameCore_randomRange(GAME_RNG_PICKUP, maxX - minX);
+    group->y[slot] = -(gameCore_randomRange(GAME_RNG_PICKUP, maxY - minY) + minY);
+    gameCore_poolAcquire(&group->pool, slot);
 }
 
 /**
@@ -251,7 +281,7 @@ static void placeActor(SimpleActor *actor, s16 minX, s16 maxX, s16 minY, s16 max
 static u16 randomFrameDelay(u16 minFrames, u16 maxFrames) {
     TRACE_FUNC();
     if (maxFrames <= minFrames) return minFrames;
-    return minFrames + (random() % (maxFrames - minFrames + 1));
+    return minFrames + gameCore_randomRange(GAME_RNG_PICKUP, maxFrames - minFrames + 1);
 }
 
 /**
@@ -259,11 +289,11 @@ static u16 randomFrameDelay(u16 minFrames, u16 maxFrames) {
  * @param index Índice del elfo en el array.
  */
 static void hideElfMark(u8 index) {
-    if (index >= NUM_ELVES) return;
+    if (index >= NUM_ELVES || !elf.markShown[index]) return;
     TRACE_FUNC();
-    elfMarkShown[index] = FALSE;
-    if (elfMarkSprites[index]) {
-        SPR_setVisibility(elfMarkSprites[index], HIDDEN);
+    elf.markShown[index] = FALSE;
+    if (elf.markSprite[index]) {
+        gameCore_sprSetVisibility(elf.markSprite[index], HIDDEN);
     }
 }
 
@@ -286,7 +316,7 @@ static s16 randomPositionWithMargin(s16 totalSize, s16 elementSize, u8 marginPer
     if (range <= 0) {
         return min;
     }
-    return min + (random() % (range + 1));
+    return min + gameCore_randomRange(GAME_RNG_PICKUP, range + 1);
 }
 
 /**
@@ -298,130 +328,120 @@ static void showElfMark(u8 index) {
     TRACE_FUNC();
     s16 posX = randomPositionWithMargin(SCREEN_WIDTH, ELF_MARK_SIZE, ELF_MARK_SCREEN_MARGIN_PERCENT);
     s16 posY = randomPositionWithMargin(SCREEN_HEIGHT, ELF_MARK_SIZE, ELF_MARK_SCREEN_MARGIN_PERCENT);
-    elfMarkPosX[index] = posX;
-    elfMarkPosY[index] = posY;
+    elf.markX[index] = posX;
+    elf.markY[index] = posY;
 
-    if (elfMarkSprites[index] == NULL) {
-        elfMarkSprites[index] = SPR_addSpriteSafe(&sprite_marca_x, posX, posY,
+    if (elf.markSprite[index] == NULL) {
+        elf.markSprite[index] = SPR_addSpriteSafe(&sprite_marca_x, posX, posY,
             TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
     }
 
-    if (elfMarkSprites[index]) {
-        SPR_setVisibility(elfMarkSprites[index], VISIBLE);
-        SPR_setPosition(elfMarkSprites[index], posX, posY);
-        SPR_setDepth(elfMarkSprites[index], SPR_MAX_DEPTH); /* siempre al fondo */
-        elfMarkShown[index] = TRUE;
+    if (elf.markSprite[index]) {
+        gameCore_sprSetVisibility(elf.markSprite[index], VISIBLE);
+        gameCore_sprSetPosition(elf.markSprite[index], posX, posY);
+        gameCore_sprSetDepth(elf.markSprite[index], SPR_MAX_DEPTH); /* siempre al fondo */
+        elf.markShown[index] = TRUE;
     }
 }
 
 /** @brief Posiciona un árbol aleatorio en el escenario. */
-static void spawnTree(SimpleActor *tree) {
+static void spawnTree(u8 tree) {
     TRACE_FUNC();
     /* No permitir spawn del segundo árbol hasta que esté desbloqueado. */
-    if ((tree == &trees[1]) && !secondTreeSpawned) {
-        tree->active = FALSE;
-        if (tree->sprite) {
-            SPR_setVisibility(tree->sprite, HIDDEN);
-        }
+    if ((tree == 1) && !secondTreeSpawned) {
+        markActorInactive(&trees, tree, "TREE");
         return;
     }
     s16 minX = leftLimit;
     s16 maxX = rightLimit - TREE_SIZE;
     if (!validateHorizontalRange(minX, maxX, "TREE")) {
-        markActorInactive(tree, "TREE");
+        markActorInactive(&trees, tree, "TREE");
         return;
     }
 
-    placeActor(tree, minX, maxX, 40, SCREEN_HEIGHT);
-    if (tree->sprite == NULL) {
-        tree->sprite = SPR_addSpriteSafe(&sprite_arbol_pista, tree->x, tree->y,
+    placeActor(&trees, tree, minX, maxX, 40, SCREEN_HEIGHT);
+    if (trees.sprite[tree] == NULL) {
+        trees.sprite[tree] = SPR_addSpriteSafe(&sprite_arbol_pista, trees.x[tree], trees.y[tree],
             TILE_ATTR(PAL_COMMON, FALSE, FALSE, FALSE));
     }
-    if (tree->sprite == NULL) {
-        markActorInactive(tree, "TREE");
+    if (trees.sprite[tree] == NULL) {
+        markActorInactive(&trees, tree, "TREE");
         return;
     }
-    tree->active = TRUE;
-    SPR_setPosition(tree->sprite, tree->x, tree->y);
-    SPR_setVisibility(tree->sprite, VISIBLE);
+    gameCore_sprSetPosition(trees.sprite[tree], trees.x[tree], trees.y[tree]);
+    gameCore_sprSetVisibility(trees.sprite[tree], VISIBLE);
 }
 
 /**
  * @brief Spawnea un elfo que lanza regalo desde un lado concreto.
- * @param elf Actor a inicializar.
+ *
+ * Marca, sombra y regalo ya quedaron ocultos al liberar el slot, así que
+ * aquí solo se coloca el elfo.
+ *
+ * @param index Slot del elfo.
  * @param side 0 izquierda, 1 derecha.
- * @param index Índice del elfo para tablas auxiliares.
  */
-static void spawnElf(SimpleActor *elf, u8 side, u8 index) {
+static void spawnElf(u8 index, u8 side) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    elf->x = (side == 0) ? (leftLimit - ELF_SIZE - 5) : (rightLimit + 5);
-    elf->y = -((random() % (SCREEN_HEIGHT - 60)) + 60);
-    elf->active = TRUE;
-    elfSpawnY[index] = elf->y;
-    hideElfMark(index);
-    elfShadowActive[index] = FALSE;
-    if (elfShadowSprites[index]) {
-        SPR_setVisibility(elfShadowSprites[index], HIDDEN);
-    }
-    elfGiftActive[index] = FALSE;
-    if (elfGiftSprites[index]) {
-        SPR_setVisibility(elfGiftSprites[index], HIDDEN);
-    }
-    // kprintf("[ELF %d] Aparece en y=%d", index, elf->y);
+    elves.x[index] = (side == 0) ? (leftLimit - ELF_SIZE - 5) : (rightLimit + 5);
+    elves.y[index] = -(gameCore_randomRange(GAME_RNG_PICKUP, SCREEN_HEIGHT - 60) + 60);
+    elf.spawnY[index] = elves.y[index];
+    // kprintf("[ELF %d] Aparece en y=%d", index, elves.y[index]);
 
-    if (elf->sprite == NULL) {
-        elf->sprite = SPR_addSpriteSafe(&sprite_elfo_lateral, elf->x, elf->y,
+    if (elves.sprite[index] == NULL) {
+        elves.sprite[index] = SPR_addSpriteSafe(&sprite_elfo_lateral, elves.x[index], elves.y[index],
             TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
     }
-    if (elf->sprite == NULL) {
-        markActorInactive(elf, "ELF");
+    if (elves.sprite[index] == NULL) {
+        markActorInactive(&elves, index, "ELF");
         return;
     }
-    elf->active = TRUE;
-    SPR_setHFlip(elf->sprite, side == 1);
-    SPR_setAnim(elf->sprite, 0);
-    SPR_setAutoAnimation(elf->sprite, TRUE);
-    SPR_setPosition(elf->sprite, elf->x, elf->y);
-    SPR_setVisibility(elf->sprite, VISIBLE);
+    gameCore_poolAcquire(&elves.pool, index);
+    gameCore_sprSetHFlip(elves.sprite[index], side == 1);
+    gameCore_sprSetAnim(elves.sprite[index], 0);
+    SPR_setAutoAnimation(elves.sprite[index], TRUE);
+    gameCore_sprSetPosition(elves.sprite[index], elves.x[index], elves.y[index]);
+    gameCore_sprSetVisibility(elves.sprite[index], VISIBLE);
 }
 
-/** @brief Crea un enemigo lateral que intentará robar el regalo. */
-static void spawnEnemy(SimpleActor *enemy) {
+/** @brief Crea (o recoloca) un enemigo lateral que intentará robar el regalo. */
+static void spawnEnemy(u8 enemy) {
     TRACE_FUNC();
     s16 minX = leftLimit;
     s16 maxX = rightLimit - ENEMY_SIZE;
     if (!validateHorizontalRange(minX, maxX, "ENEMY")) {
-        markActorInactive(enemy, "ENEMY");
+        markActorInactive(&enemies, enemy, "ENEMY");
         return;
     }
 
-    placeActor(enemy, minX, maxX, 30, SCREEN_HEIGHT);
-    if (enemy->sprite == NULL) {
-        enemy->sprite = SPR_addSpriteSafe(&sprite_duende_malo, enemy->x, enemy->y,
+    placeActor(&enemies, enemy, minX, maxX, 30, SCREEN_HEIGHT);
+    enemyLateralDir[enemy] = 0;
+    if (enemies.sprite[enemy] == NULL) {
+        enemies.sprite[enemy] = SPR_addSpriteSafe(&sprite_duende_malo, enemies.x[enemy], enemies.y[enemy],
             TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     }
-    if (enemy->sprite == NULL) {
-        markActorInactive(enemy, "ENEMY");
+    if (enemies.sprite[enemy] == NULL) {
+        markActorInactive(&enemies, enemy, "ENEMY");
         return;
     }
-    enemy->active = TRUE;
-    SPR_setPosition(enemy->sprite, enemy->x, enemy->y);
-    SPR_setAnim(enemy->sprite, 0);
-    SPR_setAutoAnimation(enemy->sprite, TRUE);
-    SPR_setVisibility(enemy->sprite, VISIBLE);
+    gameCore_sprSetPosition(enemies.sprite[enemy], enemies.x[enemy], enemies.y[enemy]);
+    gameCore_sprSetAnim(enemies.sprite[enemy], 0);
+    SPR_setAutoAnimation(enemies.sprite[enemy], TRUE);
+    gameCore_sprSetVisibility(enemies.sprite[enemy], VISIBLE);
 }
 
+
 /** @brief Oculta la sombra asociada al elfo indicado. */
 static void hideElfShadow(u8 index) {
-    if (index >= NUM_ELVES) return;
+    if (index >= NUM_ELVES || !elf.shadowActive[index]) return;
     TRACE_FUNC();
-    elfShadowActive[index] = FALSE;
-    if (elfShadowSprites[index]) {
-        SPR_setVisibility(elfShadowSprites[index], HIDDEN);
+    elf.shadowActive[index] = FALSE;
+    if (elf.shadowSprite[index]) {
+        gameCore_sprSetVisibility(elf.shadowSprite[index], HIDDEN);
     }
-    elfShadowPosX[index] = elfShadowStartX[index];
-    elfShadowPosY[index] = elfShadowStartY[index];
+    elf.shadowX[index] = elf.shadowStartX[index];
+    elf.shadowY[index] = elf.shadowStartY[index];
 }
 
 /**
@@ -433,25 +453,25 @@ static void hideElfShadow(u8 index) {
 static void showElfShadow(u8 index, s16 startX, s16 startY) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    elfShadowStartX[index] = startX;
-    elfShadowStartY[index] = startY;
-    elfShadowActive[index] = TRUE;
-    elfShadowPosX[index] = startX;
-    elfShadowPosY[index] = startY;
-
-    if (elfShadowSprites[index] == NULL) {
-        elfShadowSprites[index] = SPR_addSpriteSafe(&sprite_sombra_regalo, startX, startY,
+    elf.shadowStartX[index] = startX;
+    elf.shadowStartY[index] = startY;
+    elf.shadowActive[index] = TRUE;
+    elf.shadowX[index] = startX;
+    elf.shadowY[index] = startY;
+
+    if (elf.shadowSprite[index] == NULL) {
+        elf.shadowSprite[index] = SPR_addSpriteSafe(&sprite_sombra_regalo, startX, startY,
             TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     }
-    if (elfShadowSprites[index]) {
-        SPR_setVisibility(elfShadowSprites[index], VISIBLE);
-        SPR_setDepth(elfShadowSprites[index], ELF_SHADOW_MIN_DEPTH);
-        SPR_setPosition(elfShadowSprites[index], startX, startY);
-        elfShadowPosX[index] = startX;
-        elfShadowPosY[index] = startY;
+    if (elf.shadowSprite[index]) {
+        gameCore_sprSetVisibility(elf.shadowSprite[index], VISIBLE);
+        gameCore_sprSetDepth(elf.shadowSprite[index], ELF_SHADOW_MIN_DEPTH);
+        gameCore_sprSetPosition(elf.shadowSprite[index], startX, startY);
+        elf.shadowX[index] = startX;
+        elf.shadowY[index] = startY;
         // kprintf("[ELF %d] Sombra iniciada en (%d,%d)", index, startX, startY);
     } else {
-        elfShadowActive[index] = FALSE;
+        elf.shadowActive[index] = FALSE;
     }
 }
 
@@ -461,18 +481,29 @@ static void showElfShadow(u8 index, s16 startX, s16 startY) {
  * @param playDisappearSfx TRUE para reproducir sonido de desaparición.
  */
 static void hideElfGift(u8 index, u8 playDisappearSfx) {
-    if (index >= NUM_ELVES) return;
+    if (index >= NUM_ELVES || !elf.giftActive[index]) return;
     TRACE_FUNC();
-    if (playDisappearSfx && elfGiftActive[index]) {
+    if (playDisappearSfx) {
         XGM2_playPCM(snd_regalo_desaparece, sizeof(snd_regalo_desaparece), SOUND_PCM_CH_AUTO);
     }
-    elfGiftActive[index] = FALSE;
-    elfGiftHasLanded[index] = FALSE;
-    if (elfGiftSprites[index]) {
-        SPR_setVisibility(elfGiftSprites[index], HIDDEN);
+    elf.giftActive[index] = FALSE;
+    elf.giftLanded[index] = FALSE;
+    if (elf.giftSprite[index]) {
+        gameCore_sprSetVisibility(elf.giftSprite[index], HIDDEN);
     }
 }
 
+/**
+ * @brief Oculta marca, sombra y regalo del elfo (solo toca lo que esté visible).
+ * @param index Índice del elfo.
+ * @param playDisappearSfx TRUE para reproducir sonido si el regalo estaba en vuelo.
+ */
+static void hideElfEffects(u8 index, u8 playDisappearSfx) {
+    hideElfMark(index);
+    hideElfShadow(index);
+    hideElfGift(index, playDisappearSfx);
+}
+
 /**
  * @brief Activa el regalo lanzado por el elfo y lo posiciona.
  * @param index Índice del elfo.
@@ -482,19 +513,21 @@ static void hideElfGift(u8 index, u8 playDisappearSfx) {
 static void showElfGift(u8 index, s16 startX, s16 startY) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    elfGiftActive[index] = TRUE;
-    elfGiftHasLanded[index] = FALSE;
-    elfGiftPosX[index] = startX;
-    elfGiftPosY[index] = startY;
-    if (elfGiftSprites[index] == NULL) {
-        elfGiftSprites[index] = SPR_addSpriteSafe(&sprite_regalo, startX, startY,
+    elf.giftActive[index] = TRUE;
+    elf.giftLanded[index] = FALSE;
+    elf.giftX[index] = startX;
+    elf.giftY[index] = startY;
+    gameCore_lineInit(&elf.giftPath[index], elf.shadowStartX[index], elf.shadowStartY[index],
+        elf.markX[index], elf.markY[index], 0);
+    if (elf.giftSprite[index] == NULL) {
+        elf.giftSprite[index] = SPR_addSpriteSafe(&sprite_regalo, startX, startY,
             TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     }
-    if (elfGiftSprites[index]) {
-        SPR_setVisibility(elfGiftSprites[index], VISIBLE);
-        SPR_setPosition(elfGiftSprites[index], startX, startY);
+    if (elf.giftSprite[index]) {
+        gameCore_sprSetVisibility(elf.giftSprite[index], VISIBLE);
+        gameCore_sprSetPosition(elf.giftSprite[index], startX, startY);
         // Reproduce aleatoriamente snd_regalo_disparado1, 2 o 3
-        switch (random() % 3) {
+        switch (gameCore_randomRange(GAME_RNG_PICKUP, 3)) {
             case 0:
                 XGM2_playPCM(snd_regalo_disparado1, sizeof(snd_regalo_disparado1), SOUND_PCM_CH_AUTO);
                 break;
@@ -506,12 +539,12 @@ static void showElfGift(u8 index, s16 startX, s16 startY) {
                 break;
         }
     } else {
-        elfGiftActive[index] = FALSE;
+        elf.giftActive[index] = FALSE;
     }
     /* El elfo cambia a la animacion 1 sin loop mientras lanza */
-    if (elves[index].sprite) {
-        SPR_setAnim(elves[index].sprite, 1);
-        SPR_setAnimationLoop(elves[index].sprite, FALSE);
+    if (elves.sprite[index]) {
+        gameCore_sprSetAnim(elves.sprite[index], 1);
+        SPR_setAnimationLoop(elves.sprite[index], FALSE);
     }
 }
 
@@ -523,35 +556,38 @@ static void showElfGift(u8 index, s16 startX, s16 startY) {
 static void updateElfGift(u8 index, fix16 progress) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    if (!elfGiftActive[index] || elfGiftSprites[index] == NULL) {
+    if (!elf.giftActive[index] || elf.giftSprite[index] == NULL) {
         return;
     }
 
     if (progress <= FIX16(0)) {
-        SPR_setPosition(elfGiftSprites[index], elfShadowStartX[index], elfShadowStartY[index]);
-        elfGiftPosX[index] = elfShadowStartX[index];
-        elfGiftPosY[index] = elfShadowStartY[index];
-        elfGiftHasLanded[index] = FALSE;
+        gameCore_sprSetPosition(elf.giftSprite[index], elf.shadowStartX[index], elf.shadowStartY[index]);
+        elf.giftX[index] = elf.shadowStartX[index];
+        elf.giftY[index] = elf.shadowStartY[index];
+        elf.giftLanded[index] = FALSE;
         return;
     }
 
-    const s16 dx = elfMarkPosX[index] - elfShadowStartX[index];
-    const s16 dy = elfMarkPosY[index] - elfShadowStartY[index];
-    fix16 baseXf = FIX16(elfShadowStartX[index]) + F16_mul(FIX16(dx), progress);
-    fix16 baseYf = FIX16(elfShadowStartY[index]) + F16_mul(FIX16(dy), progress);
+    /* El progreso solo crece mientras el elfo baja: se avanza la trayectoria
+     * hasta su parte proporcional del eje mayor. */
+    const u16 arcIndex = (progress > FIX16(1)) ? FIX16(1) : (u16)progress;
+    GameLineStepper *path = &elf.giftPath[index];
+    const u16 targetSteps = (u16)(((u32)path->major * arcIndex) >> FIX16_FRAC_BITS);
+    const u16 doneSteps = path->major - path->remaining;
+    if (targetSteps > doneSteps) {
+        gameCore_lineAdvance(path, targetSteps - doneSteps);
+    }
 
-    /* Arco parabólico: altura máxima GIFT_ARC_HEIGHT en t=0.5 */
-    fix16 t = progress;
-    fix16 arcFactor = F16_mul(FIX16(4), F16_mul(t, (FIX16(1) - t)));
-    fix16 arcOffsetF = F16_mul(FIX16(GIFT_ARC_HEIGHT), arcFactor);
+    /* Arco parabólico: altura máxima GIFT_ARC_HEIGHT en t=0.5 (4t(1-t) tabulado). */
+    const fix16 arcOffsetF = (fix16)(GIFT_ARC_HEIGHT * gameLut_arc[arcIndex]);
 
-    s16 posX = F16_toInt(baseXf + FIX16(0.5));
-    s16 posY = F16_toInt((baseYf - arcOffsetF) + FIX16(0.5));
-    SPR_setPosition(elfGiftSprites[index], posX, posY);
-    elfGiftPosX[index] = posX;
-    elfGiftPosY[index] = posY;
-    elfGiftHasLanded[index] = (progress >= FIX16(1));
-    if (elfGiftHasLanded[index]) {
+    s16 posX = path->x;
+    s16 posY = path->y - F16_toInt(arcOffsetF + FIX16(0.5));
+    gameCore_sprSetPosition(elf.giftSprite[index], posX, posY);
+    elf.giftX[index] = posX;
+    elf.giftY[index] = posY;
+    elf.giftLanded[index] = (progress >= FIX16(1));
+    if (elf.giftLanded[index]) {
         // kprintf("[DEBUG GIFT] landed idx=%d pos=(%d,%d)", index, posX, posY);
     }
 }
@@ -564,18 +600,16 @@ static void updateElfGift(u8 index, fix16 progress) {
 static void scheduleElfRespawn(u8 index, u8 side) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    elfSide[index] = side;
-    elfRespawnTimer[index] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
-    elves[index].active = FALSE;
-    if (elves[index].sprite) {
-        SPR_setAnim(elves[index].sprite, 0);
-        SPR_setAutoAnimation(elves[index].sprite, TRUE);
-        SPR_setVisibility(elves[index].sprite, HIDDEN);
-    }
-    hideElfMark(index);
-    hideElfShadow(index);
-    hideElfGift(index, TRUE);
-    // kprintf("[ELF %d] Respawn en %u frames (side=%d)", index, elfRespawnTimer[index], side);
+    elf.side[index] = side;
+    elf.respawnTimer[index] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
+    gameCore_poolRelease(&elves.pool, index);
+    if (elves.sprite[index]) {
+        gameCore_sprSetAnim(elves.sprite[index], 0);
+        SPR_setAutoAnimation(elves.sprite[index], TRUE);
+        gameCore_sprSetVisibility(elves.sprite[index], HIDDEN);
+    }
+    hideElfEffects(index, TRUE);
+    // kprintf("[ELF %d] Respawn en %u frames (side=%d)", index, elf.respawnTimer[index], side);
 }
 
 /**
@@ -586,58 +620,46 @@ static void scheduleElfRespawn(u8 index, u8 side) {
 static void updateElfShadow(u8 index, fix16 progress) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    if (!elfShadowActive[index] || elfShadowSprites[index] == NULL) {
+    if (!elf.shadowActive[index] || elf.shadowSprite[index] == NULL) {
         return;
     }
     if (progress <= FIX16(0)) {
-        SPR_setPosition(elfShadowSprites[index], elfShadowStartX[index], elfShadowStartY[index]);
-        elfShadowPosX[index] = elfShadowStartX[index];
-        elfShadowPosY[index] = elfShadowStartY[index];
+        gameCore_sprSetPosition(elf.shadowSprite[index], elf.shadowStartX[index], elf.shadowStartY[index]);
+        elf.shadowX[index] = elf.shadowStartX[index];
+        elf.shadowY[index] = elf.shadowStartY[index];
         return;
     }
     if (progress >= FIX16(1)) {
-        SPR_setPosition(elfShadowSprites[index], elfMarkPosX[index], elfMarkPosY[index]);
-        elfShadowPosX[index] = elfMarkPosX[index];
-        elfShadowPosY[index] = elfMarkPosY[index];
+        gameCore_sprSetPosition(elf.shadowSprite[index], elf.markX[index], elf.markY[index]);
+        elf.shadowX[index] = elf.markX[index];
+        elf.shadowY[index] = elf.markY[index];
         return;
     }
 
-    const s16 dx = elfMarkPosX[index] - elfShadowStartX[index];
-    const s16 dy = elfMarkPosY[index] - elfShadowStartY[index];
+    const s16 dx = elf.markX[index] - elf.shadowStartX[index];
+    const s16 dy = elf.markY[index] - elf.shadowStartY[index];
     fix16 offsetX = F16_mul(FIX16(dx), progress);
     fix16 offsetY = F16_mul(FIX16(dy), progress);
-    s16 newX = elfShadowStartX[index] + F16_toInt(offsetX + FIX16(0.5));
-    s16 newY = elfShadowStartY[index] + F16_toInt(offsetY + FIX16(0.5));
-    SPR_setPosition(elfShadowSprites[index], newX, newY);
-    elfShadowPosX[index] = newX;
-    elfShadowPosY[index] = newY;
+    s16 newX = elf.shadowStartX[index] + F16_toInt(offsetX + FIX16(0.5));
+    s16 newY = elf.shadowStartY[index] + F16_toInt(offsetY + FIX16(0.5));
+    gameCore_sprSetPosition(elf.shadowSprite[index], newX, newY);
+    elf.shadowX[index] = newX;
+    elf.shadowY[index] = newY;
 }
 
 /**
  * @brief Controla cuándo mostrar la marca X del elfo para facilitar su captura.
+ *
+ * Solo se llama para elfos vivos. Si el regalo ya está en zona de recogida se
+ * registra en la rejilla de colisiones; la comprobación contra Santa se hace
+ * después del bucle de elfos.
+ *
  * @param index Índice del elfo.
- * @param santaHitX Posición X de la hitbox de Santa.
- * @param santaHitY Posición Y de la hitbox de Santa.
- * @param santaHitW Anchura de la hitbox.
- * @param santaHitH Altura de la hitbox.
  */
-static void updateElfMark(u8 index, s16 santaHitX, s16 santaHitY, s16 santaHitW, s16 santaHitH) {
+static void updateElfMark(u8 index) {
     if (index >= NUM_ELVES) return;
     TRACE_FUNC();
-    const s16 elfBottom = elves[index].y + ELF_SIZE;
-
-    if (!elves[index].active) {
-        hideElfMark(index);
-        hideElfShadow(index);
-        hideElfGift(index, FALSE);
-        if (elfRespawnTimer[index] > 0) {
-            elfRespawnTimer[index]--;
-            if (elfRespawnTimer[index] == 0) {
-                spawnElf(&elves[index], elfSide[index], index);
-            }
-        }
-        return;
-    }
+    const s16 elfBottom = elves.y[index] + ELF_SIZE;
 
     const s16 minVisibleY = ELF_MARK_VISIBLE_MIN_Y;
     const s16 maxVisibleY = ELF_MARK_VISIBLE_MAX_Y;
@@ -645,60 +667,62 @@ static void updateElfMark(u8 index, s16 santaHitX, s16 santaHitY, s16 santaHitW,
     const u8 aboveRange = elfBottom > maxVisibleY;
 
     if (belowRange) {
-        hideElfMark(index);
-        hideElfShadow(index);
-        hideElfGift(index, FALSE);
+        hideElfEffects(index, FALSE);
         return;
     }
 
     if (aboveRange) {
-        hideElfMark(index);
-        hideElfShadow(index);
-        hideElfGift(index, TRUE);
+        hideElfEffects(index, TRUE);
         return;
     }
 
     /* Muestra solo dentro del rango visible (una vez por aparición) */
-    if (!elfMarkShown[index]) {
+    if (!elf.markShown[index]) {
         showElfMark(index);
-        showElfShadow(index, elves[index].x, elves[index].y);
-        showElfGift(index, elves[index].x, elves[index].y);
+        showElfShadow(index, elves.x[index], elves.y[index]);
+        showElfGift(index, elves.x[index], elves.y[index]);
     }
 
     /* Progreso lineal del viaje de la sombra basado en la posición del elfo en la franja */
     const s16 travelSpan = maxVisibleY - minVisibleY;
     fix16 progress = FIX16(0);
     if (travelSpan > 0) {
-        progress = FIX16(elfBottom - minVisibleY);
-        progress = F16_div(progress, FIX16(travelSpan));
+        progress = GAME_LUT_RATIO_FIX16(elfBottom - minVisibleY, travelSpan);
     }
     if (progress < FIX16(0)) progress = FIX16(0);
     if (progress > FIX16(1)) progress = FIX16(1);
 
-    updateElfShadow(index, progress);
+    if (gameCore_qualityShouldRun(qualityShadows)) {
+        updateElfShadow(index, progress);
+    }
     updateElfGift(index, progress);
 
-    if (elfGiftActive[index]  && progress >= FIX16(0.9)) { // Empieza a checkear desde el 90% de caída
-        if (gameCore_checkCollision(santaHitX-SANTA_COLECT_EXTRA_MARGIN, santaHitY-SANTA_COLECT_EXTRA_MARGIN, santaHitW+SANTA_COLECT_EXTRA_MARGIN*2, santaHitH+SANTA_COLECT_EXTRA_MARGIN*2, // Hitbox de Santa con margen extra
-                elfGiftPosX[index], elfGiftPosY[index], GIFT_SIZE, GIFT_SIZE)) {
-            // kprintf("[DEBUG GIFT] collect landed idx=%d giftPos=(%d,%d) santaHit=(%d,%d,%d,%d)", index,
-            //     elfGiftPosX[index], elfGiftPosY[index], santaHitX, santaHitY, santaHitW, santaHitH);
-            collectGift();
-            hideElfMark(index);
-            hideElfShadow(index);
-            hideElfGift(index, FALSE);
-            scheduleElfRespawn(index, elfSide[index]);
-        }
+    if (elf.giftActive[index]  && progress >= FIX16(0.9)) { // Empieza a checkear desde el 90% de caída
+        gameCore_gridAdd(elf.giftX[index], elf.giftY[index], GIFT_SIZE, GIFT_SIZE, LAYER_GIFT, index);
     }
 }
 
+/**
+ * @brief Recoge el regalo lanzado por un elfo y programa su reaparición.
+ * @param index Índice del elfo.
+ */
+static void collectElfGift(u8 index) {
+    if (index >= NUM_ELVES || !elf.giftActive[index]) return;
+    TRACE_FUNC();
+    // kprintf("[DEBUG GIFT] collect landed idx=%d giftPos=(%d,%d)", index,
+    //     elf.giftX[index], elf.giftY[index]);
+    collectGift();
+    hideElfEffects(index, FALSE);
+    scheduleElfRespawn(index, elf.side[index]);
+}
+
 /** @brief Reinicia el ataque especial si ya estaba cargado. */
 static void resetSpecialIfReady(void) {
     TRACE_FUNC();
     if (giftsCharge >= GIFTS_FOR_SPECIAL) {
         santa.specialReady = TRUE;
         /* Animacion alternativa desactivada para evitar errores si no existe */
-        SPR_setAnim(santa.sprite, 0);
+        gameCore_sprSetAnim(santa.sprite, 0);
     }
 }
 
@@ -776,17 +800,17 @@ static void collectGift(void) {
 
     if (giftsCollected == 3 && activeEnemyCount == 1) { // A los 3 regalos, spawnea el segundo enemigo
         activeEnemyCount = 2;
-        spawnEnemy(&enemies[1]);
+        spawnEnemy(1);
         // kprintf("[DEBUG ENEMY] activeEnemyCount aumentó a 2");
     } else if (giftsCollected == 6 && activeEnemyCount == 2) { // A los 6 regalos, spawnea el tercer enemigo
         activeEnemyCount = 3;
-        spawnEnemy(&enemies[2]);
+        spawnEnemy(2);
         // kprintf("[DEBUG ENEMY] activeEnemyCount aumentó a 3");
     }
     if (!secondTreeSpawned && (giftsCollected >= GIFTS_FOR_SECOND_TREE)) {
         secondTreeSpawned = TRUE;
-        spawnTree(&trees[1]);
-        if (trees[1].active) {
+        spawnTree(1);
+        if (gameCore_poolIsActive(&trees.pool, 1)) {
             // kprintf("[DEBUG TREE] Segundo árbol activado (regalos=%u)", giftsCollected);
         }
     }
@@ -804,17 +828,17 @@ static void collectGift(void) {
 static void clearEnemies(void) {
     TRACE_FUNC();
     for (u8 i = 0; i < activeEnemyCount; i++) {
-        spawnEnemy(&enemies[i]);
+        spawnEnemy(i);
     }
 }
 
 /** @brief Alterna la visibilidad de Santa durante el parpadeo por colisión. */
 static void setTreeCollisionVisibility(u8 visible) {
     if (santa.sprite) {
-        SPR_setVisibility(santa.sprite, visible ? VISIBLE : HIDDEN);
+        gameCore_sprSetVisibility(santa.sprite, visible ? VISIBLE : HIDDEN);
     }
-    if (collidedTree && collidedTree->sprite) {
-        SPR_setVisibility(collidedTree->sprite, visible ? VISIBLE : HIDDEN);
+    if (collidedTree != GAME_POOL_NONE && trees.sprite[collidedTree]) {
+        gameCore_sprSetVisibility(trees.sprite[collidedTree], visible ? VISIBLE : HIDDEN);
     }
 }
 
@@ -838,9 +862,9 @@ static void resumeSantaAnimation(void) {
 
 /**
  * @brief Inicia el estado de colisión con un árbol.
- * @param tree Árbol con el que colisionó Santa.
+ * @param tree Slot del árbol con el que colisionó Santa.
  */
-static void beginTreeCollision(SimpleActor *tree) {
+static void beginTreeCollision(u8 tree) {
     TRACE_FUNC();
     if (recoveringFromTree) return;
 
@@ -868,15 +892,15 @@ static void endTreeCollisionRecovery(void) {
 
     setTreeCollisionVisibility(TRUE);
 
-    if (collidedTree) {
+    if (collidedTree != GAME_POOL_NONE) {
         spawnTree(collidedTree);
     }
-    collidedTree = NULL;
+    collidedTree = GAME_POOL_NONE;
 
     /* Reactivar cualquier árbol que quedara oculto tras la colisión. */
     for (u8 i = 0; i < NUM_TREES; i++) {
-        if (!trees[i].active) {
-            spawnTree(&trees[i]);
+        if (!gameCore_poolIsActive(&trees.pool, i)) {
+            spawnTree(i);
         }
     }
 
@@ -885,18 +909,18 @@ static void endTreeCollisionRecovery(void) {
     santa.vx = 0;
     santa.vy = 0;
     if (santa.sprite) {
-        SPR_setPosition(santa.sprite, santa.x, santa.y);
-        SPR_setVisibility(santa.sprite, VISIBLE);
+        gameCore_sprSetPosition(santa.sprite, santa.x, santa.y);
+        gameCore_sprSetVisibility(santa.sprite, VISIBLE);
     }
 
     XGM2_playPCM(snd_santa_hohoho, sizeof(snd_santa_hohoho), SOUND_PCM_CH_AUTO);
 
     for (u8 i = 0; i < activeEnemyCount; i++) {
-        spawnEnemy(&enemies[i]);
+        spawnEnemy(i);
     }
     for (u8 i = 0; i < NUM_ELVES; i++) {
-        if (elfRespawnTimer[i] == 0) {
-            elfRespawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
+        if (elf.respawnTimer[i] == 0) {
+            elf.respawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
         }
     }
 
@@ -929,11 +953,11 @@ static void updateTreeCollisionRecovery(void) {
 
 /**
  * @brief Calcula una posición de huida para el enemigo ladrón.
- * @param enemy Referencia al enemigo.
+ * @param enemy Slot del enemigo.
  * @param targetX Salida X objetivo.
  * @param targetY Salida Y objetivo.
  */
-static void selectEnemyEscapeTarget(SimpleActor *enemy, s16 *targetX, s16 *targetY) {
+static void selectEnemyEscapeTarget(u8 enemy, s16 *targetX, s16 *targetY) {
     TRACE_FUNC();
     const s16 cornerX[4] = { -ENEMY_SIZE, SCREEN_WIDTH, -ENEMY_SIZE, SCREEN_WIDTH };
     const s16 cornerY[4] = { -ENEMY_SIZE, -ENEMY_SIZE, SCREEN_HEIGHT, SCREEN_HEIGHT };
@@ -941,8 +965,8 @@ static void selectEnemyEscapeTarget(SimpleActor *enemy, s16 *targetX, s16 *targe
     u8 bestIndex = 0;
 
     for (u8 i = 0; i < 4; i++) {
-        s32 dx = (s32)cornerX[i] - (s32)enemy->x;
-        s32 dy = (s32)cornerY[i] - (s32)enemy->y;
+        s32 dx = (s32)cornerX[i] - (s32)enemies.x[enemy];
+        s32 dy = (s32)cornerY[i] - (s32)enemies.y[enemy];
         u32 dist = (u32)(dx * dx + dy * dy);
         if (dist < bestDist) {
             bestDist = dist;
@@ -960,7 +984,7 @@ static void endEnemyStealSequence(void) {
     giftCounter_stopBlink(&giftCounterBlink);
     updateGiftCounter();
     enemyStealActive = FALSE;
-    spawnEnemy(&enemies[enemyStealIndex]);
+    spawnEnemy(enemyStealIndex);
 }
 
 /**
@@ -972,10 +996,10 @@ static void beginEnemyStealSequence(u8 enemyIndex) {
     TRACE_FUNC();
     enemyStealActive = TRUE;
     enemyStealIndex = enemyIndex;
-    selectEnemyEscapeTarget(&enemies[enemyIndex], &enemyEscapeTargetX, &enemyEscapeTargetY);
-    if (enemies[enemyIndex].sprite) {
-        SPR_setAnim(enemies[enemyIndex].sprite, 1);
-        SPR_setAutoAnimation(enemies[enemyIndex].sprite, TRUE);
+    selectEnemyEscapeTarget(enemyIndex, &enemyEscapeTargetX, &enemyEscapeTargetY);
+    if (enemies.sprite[enemyIndex]) {
+        gameCore_sprSetAnim(enemies.sprite[enemyIndex], 1);
+        SPR_setAutoAnimation(enemies.sprite[enemyIndex], TRUE);
     }
     XGM2_playPCM(snd_elfo_robando, sizeof(snd_elfo_robando), SOUND_PCM_CH_AUTO);
 }
@@ -984,15 +1008,16 @@ static void beginEnemyStealSequence(u8 enemyIndex) {
 static void updateEnemyStealSequence(void) {
     if (!enemyStealActive) return;
     TRACE_FUNC();
-    SimpleActor *enemy = &enemies[enemyStealIndex];
+    const u8 enemy = enemyStealIndex;
+    Sprite *sprite = enemies.sprite[enemy];
 
-    if (!enemy->active || (enemy->sprite == NULL)) {
+    if (!gameCore_poolIsActive(&enemies.pool, enemy) || (sprite == NULL)) {
         endEnemyStealSequence();
         return;
     }
 
-    s16 dx = enemyEscapeTargetX - enemy->x;
-    s16 dy = enemyEscapeTargetY - enemy->y;
+    s16 dx = enemyEscapeTargetX - enemies.x[enemy];
+    s16 dy = enemyEscapeTargetY - enemies.y[enemy];
 
     s16 stepX = 0;
     s16 stepY = 0;
@@ -1001,12 +1026,10 @@ static void updateEnemyStealSequence(void) {
     if (dy > 0) stepY = ENEMY_ESCAPE_SPEED;
     else if (dy < 0) stepY = -ENEMY_ESCAPE_SPEED;
 
-    enemy->x += stepX;
-    enemy->y += stepY;
+    enemies.x[enemy] += stepX;
+    enemies.y[enemy] += stepY;
 
-    if (enemy->sprite) {
-        SPR_setPosition(enemy->sprite, enemy->x, enemy->y);
-    }
+    gameCore_sprSetPosition(sprite, enemies.x[enemy], enemies.y[enemy]);
 
     if ((dx == 0) && (dy == 0)) {
         endEnemyStealSequence();
@@ -1014,81 +1037,40 @@ static void updateEnemyStealSequence(void) {
     }
 
     const u8 offScreen =
-        (enemy->x < -ENEMY_SIZE) || (enemy->x > SCREEN_WIDTH) ||
-        (enemy->y < -ENEMY_SIZE) || (enemy->y > SCREEN_HEIGHT);
+        (enemies.x[enemy] < -ENEMY_SIZE) || (enemies.x[enemy] > SCREEN_WIDTH) ||
+        (enemies.y[enemy] < -ENEMY_SIZE) || (enemies.y[enemy] > SCREEN_HEIGHT);
     if (offScreen) {
         endEnemyStealSequence();
     }
 }
 
-typedef struct {
-    Sprite* sprite;
-    s16 bottom;
-} DepthEntry;
+/**
+ * @brief Envía a la lista de profundidad los actores vivos de un grupo.
+ * @param group Grupo a recorrer (solo slots vivos).
+ * @param height Alto del sprite para calcular la base.
+ */
+static void submitActorDepths(const ActorPool *group, s16 height) {
+    u16 live = group->pool.activeMask;
+    while (live) {
+        const u8 i = gameCore_poolNextSlot(&live);
+        gameCore_depthSubmit(&depthList, group->sprite[i], group->y[i] + height);
+    }
+}
 
-/** @brief Ordena la profundidad de sprites según su base (eje Y). */
+/** @brief Ordena la profundidad de sprites según su base (eje Y); el que está más abajo va delante. */
 static void reorderDepthByBottom(void) {
     TRACE_FUNC();
-    DepthEntry entries[NUM_TREES + NUM_ENEMIES + NUM_ELVES + NUM_ELVES + 1];
-    u8 count = 0;
-
-    if (santa.sprite) {
-        entries[count].sprite = santa.sprite;
-        entries[count].bottom = santa.y + SANTA_HEIGHT;
-        count++;
-    }
-
-    for (u8 i = 0; i < NUM_TREES; i++) {
-        if (trees[i].sprite && trees[i].active) {
-            if (count >= sizeof(entries) / sizeof(entries[0])) break;
-            entries[count].sprite = trees[i].sprite;
-            entries[count].bottom = trees[i].y + TREE_SIZE;
-            count++;
-        }
-    }
-
-    for (u8 i = 0; i < NUM_ENEMIES; i++) {
-        if (enemies[i].sprite && enemies[i].active) {
-            if (count >= sizeof(entries) / sizeof(entries[0])) break;
-            entries[count].sprite = enemies[i].sprite;
-            entries[count].bottom = enemies[i].y + ENEMY_SIZE;
-            count++;
-        }
-    }
-
+    gameCore_depthBegin(&depthList);
+    gameCore_depthSubmit(&depthList, santa.sprite, santa.y + SANTA_HEIGHT);
+    submitActorDepths(&trees, TREE_SIZE);
+    submitActorDepths(&enemies, ENEMY_SIZE);
+    submitActorDepths(&elves, ELF_SIZE);
     for (u8 i = 0; i < NUM_ELVES; i++) {
-        if (elves[i].sprite && elves[i].active) {
-            if (count >= sizeof(entries) / sizeof(entries[0])) break;
-            entries[count].sprite = elves[i].sprite;
-            entries[count].bottom = elves[i].y + ELF_SIZE;
-            count++;
+        if (elf.giftActive[i]) {
+            gameCore_depthSubmit(&depthList, elf.giftSprite[i], elf.giftY[i] + GIFT_SIZE);
         }
     }
-
-    for (u8 i = 0; i < NUM_ELVES; i++) {
-        if (elfGiftSprites[i] && elfGiftActive[i]) {
-            if (count >= sizeof(entries) / sizeof(entries[0])) break;
-            entries[count].sprite = elfGiftSprites[i];
-            entries[count].bottom = elfGiftPosY[i] + GIFT_SIZE;
-            count++;
-        }
-    }
-
-    /* Ordenar por bottom descendente (el que esta mas abajo va delante) */
-    for (u8 i = 0; i < count; i++) {
-        for (u8 j = i + 1; j < count; j++) {
-            if (entries[j].bottom > entries[i].bottom) {
-                DepthEntry tmp = entries[i];
-                entries[i] = entries[j];
-                entries[j] = tmp;
-            }
-        }
-    }
-
-    u16 depth = DEPTH_ACTORS_START;
-    for (u8 i = 0; i < count; i++) {
-        SPR_setDepth(entries[i].sprite, depth++);
-    }
+    gameCore_depthCommit(&depthList);
 }
 
 #if DEBUG_MODE
@@ -1098,11 +1080,23 @@ static void renderDebug(void) {
 }
 #endif
 
+/** @brief Sube la pista y la nieve durante la cutscene de la fase 1. */
+void minigamePickup_preload(void) {
+    gameCore_vramPreload("pista_polo", &image_pista_polo_tile);
+    snowEffect_preload();
+}
+
 /** @brief Inicializa recursos, estado y entidades de la fase de recogida. */
 void minigamePickup_init(void) {
     TRACE_FUNC();
     audio_stop_music();
     gameCore_resetVideoState();
+    gameCore_resetRandomStream(GAME_RNG_PICKUP);
+    /* Orden de recorte bajo carga: lo primero en caer es lo menos visible. */
+    qualitySnow = gameCore_qualityRegister("nieve", 2);
+    qualityShadows = gameCore_qualityRegister("sombras", 4);
+    qualityHudBlink = gameCore_qualityRegister("hud", 4);
+    qualityDepth = gameCore_qualityRegister("profundidad", 4);
     giftsCollected = 0;
     maxGiftsCollected = 0;
     giftsCharge = 0;
@@ -1114,7 +1108,7 @@ void minigamePickup_init(void) {
     recoveringFromTree = FALSE;
     treeCollisionBlinkFrames = 0;
     treeCollisionVisible = TRUE;
-    collidedTree = NULL;
+    collidedTree = GAME_POOL_NONE;
     enemyStealActive = FALSE;
     enemyStealIndex = 0;
     enemyEscapeTargetX = 0;
@@ -1135,9 +1129,6 @@ void minigamePickup_init(void) {
     santaInertia.frictionDelay = 3; /* frena cada 3 frames para aumentar la inercia */
     santaInertia.maxVelocity = 6;
 
-    if (image_pista_polo_pal.data) {
-        PAL_setPalette(PAL_COMMON, image_pista_polo_pal.data, CPU);
-    }
     if (sprite_santa_car.palette) {
         PAL_setPalette(PAL_PLAYER, sprite_santa_car.palette->data, CPU);
     }
@@ -1147,17 +1138,16 @@ void minigamePickup_init(void) {
 
     VDP_setBackgroundColor(0);
 
-    VDP_loadTileSet(&image_pista_polo_tile, globalTileIndex, CPU);
-    mapTrack = MAP_create(&image_pista_polo_map, BG_B,
-        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_pista_polo_tile.numTile;   
+    const u16 trackTiles = gameCore_vramBind("pista_polo", &image_pista_polo_tile);
     trackOffsetY = TRACK_LOOP_PX;
-    if (mapTrack != NULL) {
-        MAP_scrollTo(mapTrack, 0, trackOffsetY);
-    }
-    SYS_doVBlankProcess();
+    gameCore_loopPlaneInit(&trackPlane, &image_pista_polo_map, BG_B,
+        TILE_ATTR_FULL(PAL_COMMON, FALSE, FALSE, FALSE, trackTiles),
+        TRACK_WIDTH_PX, TRACK_LOOP_PX, trackOffsetY);
+    gameCore_waitVBlank();
 
-    snowEffect_init(&snowEffect, &globalTileIndex, 1, -4);
+    snowEffect_init(&snowEffect, 1, -4);
+    /* Pista y nieve llegan por tramos: el plano se enseña al terminar la cola. */
+    gameCore_dmaFadeInWhenDone(PAL_COMMON, image_pista_polo_pal.data, GAME_DMA_FADE_FRAMES);
 
     santaStartX = leftLimit + (playableWidth / 4); /* centro aproximado de la mitad izquierda */
     santaStartY = santaMaxY;
@@ -1168,9 +1158,9 @@ void minigamePickup_init(void) {
     santa.specialReady = FALSE;
     santa.sprite = SPR_addSpriteSafe(&sprite_santa_car, santa.x, santa.y,
         TILE_ATTR(PAL_PLAYER, FALSE, FALSE, FALSE));
-    SPR_setAnim(santa.sprite, 0);
-    SPR_setDepth(santa.sprite, DEPTH_SANTA);
+    gameCore_sprSetAnim(santa.sprite, 0);
     SPR_setAutoAnimation(santa.sprite, TRUE);
+    gameCore_depthInit(&depthList, DEPTH_ACTORS_START);
     XGM2_playPCM(snd_santa_hohoho, sizeof(snd_santa_hohoho), SOUND_PCM_CH_AUTO);
 
     const s16 giftBaseX = SCREEN_WIDTH - HUD_MARGIN_PX - GIFT_COUNTER_SPRITE_WIDTH;
@@ -1180,9 +1170,9 @@ void minigamePickup_init(void) {
         giftBaseX, giftBaseY - GIFT_COUNTER_ROW_OFFSET_Y,
         TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     if (giftCounterSpriteFirstRow) {
-        SPR_setAnim(giftCounterSpriteFirstRow, 0);
-        SPR_setFrame(giftCounterSpriteFirstRow, 0);
-        SPR_setDepth(giftCounterSpriteFirstRow, DEPTH_HUD + 1);
+        gameCore_sprSetAnim(giftCounterSpriteFirstRow, 0);
+        gameCore_sprSetFrame(giftCounterSpriteFirstRow, 0);
+        gameCore_sprSetDepth(giftCounterSpriteFirstRow, DEPTH_HUD + 1);
         SPR_setAutoAnimation(giftCounterSpriteFirstRow, FALSE);
     }
 
@@ -1190,9 +1180,9 @@ void minigamePickup_init(void) {
         giftBaseX + GIFT_COUNTER_SECOND_ROW_OFFSET_X, giftBaseY,
         TILE_ATTR(PAL_EFFECT, FALSE, FALSE, FALSE));
     if (giftCounterSpriteSecondRow) {
-        SPR_setAnim(giftCounterSpriteSecondRow, 0);
-        SPR_setFrame(giftCounterSpriteSecondRow, 0);
-        SPR_setDepth(giftCounterSpriteSecondRow, DEPTH_HUD);
+        gameCore_sprSetAnim(giftCounterSpriteSecondRow, 0);
+        gameCore_sprSetFrame(giftCounterSpriteSecondRow, 0);
+        gameCore_sprSetDepth(giftCounterSpriteSecondRow, DEPTH_HUD);
         SPR_setAutoAnimation(giftCounterSpriteSecondRow, FALSE);
     }
 
@@ -1204,39 +1194,41 @@ void minigamePickup_init(void) {
 
     updateGiftCounter();
 
+    gameCore_poolInit(&trees.pool, NUM_TREES);
     for (u8 i = 0; i < NUM_TREES; i++) {
-        trees[i].sprite = NULL;
-        trees[i].active = FALSE;
-        trees[i].x = 0;
-        trees[i].y = 0;
+        trees.sprite[i] = NULL;
+        trees.x[i] = 0;
+        trees.y[i] = 0;
     }
-    spawnTree(&trees[0]);
+    spawnTree(0);
+    /* Los elfos empiezan con el slot libre y un retardo de aparición. */
+    gameCore_poolInit(&elves.pool, NUM_ELVES);
     for (u8 i = 0; i < NUM_ELVES; i++) {
-        elves[i].sprite = NULL;
-        elfMarkSprites[i] = NULL;
-        elfShadowSprites[i] = NULL;
-        elfShadowActive[i] = FALSE;
-        elfMarkPosX[i] = 0;
-        elfMarkPosY[i] = 0;
-        elfShadowPosX[i] = 0;
-        elfShadowPosY[i] = 0;
-        elfGiftSprites[i] = NULL;
-        elfGiftActive[i] = FALSE;
-        elfGiftHasLanded[i] = FALSE;
-        elfGiftPosX[i] = 0;
-        elfGiftPosY[i] = 0;
-        elfRespawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
-        elfSide[i] = i % 2;
-        elves[i].active = FALSE;
-        // kprintf("[ELF %d] Respawn inicial en %u frames", i, elfRespawnTimer[i]);
-    }
+        elves.sprite[i] = NULL;
+        elf.markShown[i] = FALSE;
+        elf.markSprite[i] = NULL;
+        elf.shadowSprite[i] = NULL;
+        elf.shadowActive[i] = FALSE;
+        elf.markX[i] = 0;
+        elf.markY[i] = 0;
+        elf.shadowX[i] = 0;
+        elf.shadowY[i] = 0;
+        elf.giftSprite[i] = NULL;
+        elf.giftActive[i] = FALSE;
+        elf.giftLanded[i] = FALSE;
+        elf.giftX[i] = 0;
+        elf.giftY[i] = 0;
+        elf.respawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
+        elf.side[i] = i % 2;
+        // kprintf("[ELF %d] Respawn inicial en %u frames", i, elf.respawnTimer[i]);
+    }
+    gameCore_poolInit(&enemies.pool, NUM_ENEMIES);
+    gameCore_aiSlicerInit(&enemyAi, NUM_ENEMIES, ENEMY_AI_PER_FRAME);
     activeEnemyCount = 1;  // Empieza con 1 enemigo
     for (u8 i = 0; i < NUM_ENEMIES; i++) {
-        enemies[i].sprite = NULL;
+        enemies.sprite[i] = NULL;
         if (i < activeEnemyCount) {
-            spawnEnemy(&enemies[i]);  // Spawneamos solo los activos
-        } else {
-            enemies[i].active = FALSE;  // Los demás inactivos
+            spawnEnemy(i);  // Spawneamos solo los activos; los demás quedan libres
         }
     }
 }
@@ -1245,7 +1237,9 @@ void minigamePickup_init(void) {
 void minigamePickup_update(void) {
     TRACE_FUNC();
     startMusicAfterHoHoHo();
-    updateGiftCounter();
+    if (gameCore_qualityShouldRun(qualityHudBlink)) {
+        updateGiftCounter();
+    }
     updateTreeCollisionRecovery();
     if (recoveringFromTree) {
         frameCounter++;
@@ -1271,7 +1265,7 @@ void minigamePickup_update(void) {
     if (santa.specialReady && (input & BUTTON_B)) {
         santa.specialReady = FALSE;
         giftsCharge = 0;
-        SPR_setAnim(santa.sprite, 0);
+        gameCore_sprSetAnim(santa.sprite, 0);
         clearEnemies();
     }
 
@@ -1280,8 +1274,7 @@ void minigamePickup_update(void) {
         leftLimit, leftLimit + playableWidth,
         santaMinY, santaMaxY,
         frameCounter, &santaInertia);
-    SPR_setPosition(santa.sprite, santa.x, santa.y);
-    SPR_setDepth(santa.sprite, DEPTH_SANTA);
+    gameCore_sprSetPosition(santa.sprite, santa.x, santa.y);
 
     /* Caja de colisión reducida: solo los 40 px centrales (80 px de sprite) */
     const s16 santaHitX = santa.x + SANTA_HITBOX_PADDING;
@@ -1301,87 +1294,122 @@ void minigamePickup_update(void) {
         if (trackOffsetY < 0) {
             trackOffsetY += TRACK_LOOP_PX;
         }
-        if (mapTrack != NULL) {
-            MAP_scrollTo(mapTrack, 0, trackOffsetY);
-            //VDP_setVerticalScroll(BG_B, trackOffsetY);
-        }
+        gameCore_loopPlaneScroll(&trackPlane, trackOffsetY);
     }
 
-    snowEffect_update(&snowEffect, frameCounter);
+    if (gameCore_qualityShouldRun(qualitySnow)) {
+        snowEffect_update(&snowEffect, frameCounter);
+    }
 
-    for (u8 i = 0; i < NUM_TREES; i++) {
-        if (!trees[i].active) continue;
+    /* Cada grupo registra sus cajas en la rejilla y luego se consulta la de Santa. */
+    gameCore_gridClear();
+    u8 hits[GRID_MAX_HITS];
+    u8 hitCount;
+    u16 live;
+
+    live = trees.pool.activeMask;
+    while (live) {
+        const u8 i = gameCore_poolNextSlot(&live);
         if (scrollStep) {
-            trees[i].y += scrollStep;
-            if (trees[i].y > SCREEN_HEIGHT) {
-                spawnTree(&trees[i]);
+            trees.y[i] += scrollStep;
+            if (trees.y[i] > SCREEN_HEIGHT) {
+                spawnTree(i);
             }
         }
-        if (gameCore_checkCollision(santaHitX, santaHitY, santaHitW, santaHitH,
-                        trees[i].x + TREE_HITBOX_OFFSET_X, 
-                        trees[i].y + TREE_HITBOX_OFFSET_Y, 
-                        TREE_HITBOX_WIDTH, 
-                        TREE_HITBOX_HEIGHT)) {
-            beginTreeCollision(&trees[i]);
+        gameCore_gridAdd(trees.x[i] + TREE_HITBOX_OFFSET_X,
+            trees.y[i] + TREE_HITBOX_OFFSET_Y,
+            TREE_HITBOX_WIDTH,
+            TREE_HITBOX_HEIGHT, LAYER_TREE, i);
+        gameCore_sprSetPosition(trees.sprite[i], trees.x[i], trees.y[i]);
+    }
+
+    hitCount = gameCore_gridQuery(santaHitX, santaHitY, santaHitW, santaHitH, LAYER_TREE, hits, GRID_MAX_HITS);
+    for (u8 h = 0; h < hitCount; h++) {
+        const u8 tree = gameCore_gridGetEntry(hits[h])->id;
+        if (gameCore_poolIsActive(&trees.pool, tree)) {
+            beginTreeCollision(tree);
         }
-        SPR_setPosition(trees[i].sprite, trees[i].x, trees[i].y);
     }
 
-    for (u8 i = 0; i < NUM_ELVES; i++) {
-        if (!elves[i].active) {
-            hideElfMark(i);
-            hideElfShadow(i);
-            hideElfGift(i, FALSE);
-            if (elfRespawnTimer[i] > 0) {
-                elfRespawnTimer[i]--;
-                if (elfRespawnTimer[i] == 0) {
-                    spawnElf(&elves[i], elfSide[i], i);
-                }
+    /* Elfos libres: solo corre el temporizador (marca, sombra y regalo ya se ocultaron al liberarlos).
+     * Un elfo que reaparece aquí no se mueve hasta el frame siguiente. */
+    live = elves.pool.activeMask;
+    u16 waiting = (u16)~live & ((1 << NUM_ELVES) - 1);
+    while (waiting) {
+        const u8 i = gameCore_poolNextSlot(&waiting);
+        if (elf.respawnTimer[i] > 0) {
+            elf.respawnTimer[i]--;
+            if (elf.respawnTimer[i] == 0) {
+                spawnElf(i, elf.side[i]);
             }
-            continue;
         }
+    }
+
+    while (live) {
+        const u8 i = gameCore_poolNextSlot(&live);
         if (scrollStep) {
-            elves[i].y += scrollStep;
-            if (elves[i].y > SCREEN_HEIGHT) {
+            elves.y[i] += scrollStep;
+            if (elves.y[i] > SCREEN_HEIGHT) {
                 scheduleElfRespawn(i, i % 2);
                 continue;
             }
         }
-        updateElfMark(i, santaHitX, santaHitY, santaHitW, santaHitH);
-        SPR_setPosition(elves[i].sprite, elves[i].x, elves[i].y);
-    }
-
-    for (u8 i = 0; i < activeEnemyCount; i++) {
-        if (!enemies[i].active) continue;
-        enemies[i].y += scrollStep;
+        updateElfMark(i);
+        gameCore_sprSetPosition(elves.sprite[i], elves.x[i], elves.y[i]);
+    }
+
+    /* Hitbox de Santa con margen extra para recoger regalos */
+    hitCount = gameCore_gridQuery(santaHitX - SANTA_COLECT_EXTRA_MARGIN, santaHitY - SANTA_COLECT_EXTRA_MARGIN,
+        santaHitW + SANTA_COLECT_EXTRA_MARGIN * 2, santaHitH + SANTA_COLECT_EXTRA_MARGIN * 2,
+        LAYER_GIFT, hits, GRID_MAX_HITS);
+    for (u8 h = 0; h < hitCount; h++) {
+        collectElfGift(gameCore_gridGetEntry(hits[h])->id);
+    }
+
+    /* Cada enemigo mira dónde está Santa solo en su turno; el paso lateral es de cada frame. */
+    const u16 aiTurn = gameCore_aiSlicerNext(&enemyAi);
+    live = enemies.pool.activeMask;
+    while (live) {
+        const u8 i = gameCore_poolNextSlot(&live);
+        enemies.y[i] += scrollStep;
+        if (aiTurn & (1 << i)) {
+            if (enemies.x[i] < santa.x) enemyLateralDir[i] = 1;
+            else if (enemies.x[i] > santa.x) enemyLateralDir[i] = -1;
+            else enemyLateralDir[i] = 0;
+        }
         if ((frameCounter % ENEMY_LATERAL_DELAY) == 0) {
-            if (enemies[i].x < santa.x) enemies[i].x += ENEMY_LATERAL_SPEED;
-            else if (enemies[i].x > santa.x) enemies[i].x -= ENEMY_LATERAL_SPEED;
+            enemies.x[i] += enemyLateralDir[i] * ENEMY_LATERAL_SPEED;
         }
-        if (enemies[i].y > SCREEN_HEIGHT) {
-            spawnEnemy(&enemies[i]);
+        if (enemies.y[i] > SCREEN_HEIGHT) {
+            spawnEnemy(i);
         }
-        if (gameCore_checkCollision(
-                santaHitX, santaHitY, santaHitW, santaHitH,
-                enemies[i].x,
-                enemies[i].y + (ENEMY_SIZE - ENEMY_HITBOX_HEIGHT),
-                ENEMY_SIZE, ENEMY_HITBOX_HEIGHT)) {
-            if (giftsCollected > 0) {
-                applyGiftLoss(1);
-                beginEnemyStealSequence(i);
-                updateEnemyStealSequence();
-                reorderDepthByBottom();
-                frameCounter++;
-                return;
-            } else {
-                XGM2_playPCM(snd_elfo_choque, sizeof(snd_elfo_choque), SOUND_PCM_CH_AUTO);
-            }
-            spawnEnemy(&enemies[i]);
+        gameCore_gridAdd(enemies.x[i],
+            enemies.y[i] + (ENEMY_SIZE - ENEMY_HITBOX_HEIGHT),
+            ENEMY_SIZE, ENEMY_HITBOX_HEIGHT, LAYER_ENEMY, i);
+        gameCore_sprSetPosition(enemies.sprite[i], enemies.x[i], enemies.y[i]);
+    }
+
+    hitCount = gameCore_gridQuery(santaHitX, santaHitY, santaHitW, santaHitH, LAYER_ENEMY, hits, GRID_MAX_HITS);
+    for (u8 h = 0; h < hitCount; h++) {
+        const u8 i = gameCore_gridGetEntry(hits[h])->id;
+        if (!gameCore_poolIsActive(&enemies.pool, i)) continue;
+        if (giftsCollected > 0) {
+            applyGiftLoss(1);
+            beginEnemyStealSequence(i);
+            updateEnemyStealSequence();
+            reorderDepthByBottom();
+            frameCounter++;
+            return;
+        } else {
+            XGM2_playPCM(snd_elfo_choque, sizeof(snd_elfo_choque), SOUND_PCM_CH_AUTO);
         }
-        SPR_setPosition(enemies[i].sprite, enemies[i].x, enemies[i].y);
+        spawnEnemy(i);
+        gameCore_sprSetPosition(enemies.sprite[i], enemies.x[i], enemies.y[i]);
     }
 
-    reorderDepthByBottom();
+    if (gameCore_qualityShouldRun(qualityDepth)) {
+        reorderDepthByBottom();
+    }
 
     frameCounter++;
 }
@@ -1394,7 +1422,6 @@ void minigamePickup_render(void) {
 #endif
 
     SPR_update();
-    SYS_doVBlankProcess();
 }
 
 /**
@@ -1408,9 +1435,35 @@ u8 minigamePickup_isComplete(void) {
 
 /** @brief Libera el mapa de pista para evitar fugas entre fases. */
 void minigamePickup_shutdown(void) {
-    if (mapTrack) {
-        MAP_release(mapTrack);
-        mapTrack = NULL;
+    gameCore_loopPlaneRelease(&trackPlane);
+}
+
+/**
+ * @brief Lleva la fase a su peor caso: 3 enemigos, 2 árboles y 4 regalos en vuelo.
+ *
+ * Los elfos sin regalo en el aire se recolocan escalonados dentro de la franja
+ * de lanzamiento para que el siguiente update muestre marca, sombra y regalo.
+ */
+void minigamePickup_forceStress(void) {
+    TRACE_FUNC();
+    activeEnemyCount = NUM_ENEMIES;
+    secondTreeSpawned = TRUE;
+    for (u8 i = 0; i < NUM_TREES; i++) {
+        if (!gameCore_poolIsActive(&trees.pool, i)) spawnTree(i);
+    }
+    for (u8 i = 0; i < NUM_ENEMIES; i++) {
+        if (!gameCore_poolIsActive(&enemies.pool, i)) spawnEnemy(i);
+    }
+
+    const s16 bandStep = (ELF_MARK_VISIBLE_MAX_Y - ELF_MARK_VISIBLE_MIN_Y) / NUM_ELVES;
+    for (u8 i = 0; i < NUM_ELVES; i++) {
+        if (elf.giftActive[i]) continue;
+        if (!gameCore_poolIsActive(&elves.pool, i)) {
+            spawnElf(i, i % 2);
+            if (!gameCore_poolIsActive(&elves.pool, i)) continue;
+        }
+        hideElfEffects(i, FALSE);
+        elves.y[i] = ELF_MARK_VISIBLE_MIN_Y - ELF_SIZE + (i * bandStep);
     }
 }
 
@@ -1429,9 +1482,9 @@ static void startMusicAfterHoHoHo(void) {
 static void clearEnemiesOnTreeCollision(void) {
     enemyStealActive = FALSE;
     for (u8 i = 0; i < NUM_ENEMIES; i++) {
-        enemies[i].active = FALSE;
-        if (enemies[i].sprite) {
-            SPR_setVisibility(enemies[i].sprite, HIDDEN);
+        gameCore_poolRelease(&enemies.pool, i);
+        if (enemies.sprite[i]) {
+            gameCore_sprSetVisibility(enemies.sprite[i], HIDDEN);
         }
     }
 }
@@ -1439,24 +1492,22 @@ static void clearEnemiesOnTreeCollision(void) {
 /** @brief Oculta elfos y objetos cuando hay colisión con árbol. */
 static void clearElvesOnTreeCollision(void) {
     for (u8 i = 0; i < NUM_ELVES; i++) {
-        elves[i].active = FALSE;
-        elfRespawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
-        hideElfMark(i);
-        hideElfShadow(i);
-        hideElfGift(i, TRUE);
-        if (elves[i].sprite) {
-            SPR_setVisibility(elves[i].sprite, HIDDEN);
+        gameCore_poolRelease(&elves.pool, i);
+        elf.respawnTimer[i] = randomFrameDelay(ELF_RESPAWN_DELAY_MIN_FRAMES, ELF_RESPAWN_DELAY_MAX_FRAMES);
+        hideElfEffects(i, TRUE);
+        if (elves.sprite[i]) {
+            gameCore_sprSetVisibility(elves.sprite[i], HIDDEN);
         }
     }
 }
 
 /** @brief Oculta cualquier árbol distinto al que ha colisionado. */
-static void clearOtherTreesOnCollision(const SimpleActor *treeToKeep) {
+static void clearOtherTreesOnCollision(u8 treeToKeep) {
     for (u8 i = 0; i < NUM_TREES; i++) {
-        if (&trees[i] == treeToKeep) continue;
-        trees[i].active = FALSE;
-        if (trees[i].sprite) {
-            SPR_setVisibility(trees[i].sprite, HIDDEN);
+        if (i == treeToKeep) continue;
+        gameCore_poolRelease(&trees.pool, i);
+        if (trees.sprite[i]) {
+            gameCore_sprSetVisibility(trees.sprite[i], HIDDEN);
         }
     }
 }
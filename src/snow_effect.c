@@ -5,19 +5,97 @@
 
 #include "snow_effect.h"
 #include "resources_bg.h"
+#include "game_luts.h"
 
 #define SNOW_WIDTH_PX 384   /* Ancho del patrón de nieve en píxeles. */
 #define SNOW_HEIGHT_PX 512  /* Alto del patrón de nieve en píxeles. */
+#define SNOW_PLANE_COLS 64  /* Ancho del plano en tiles (VDP_setPlaneSize 64x64). */
+#define SNOW_PLANE_ROWS 64  /* Alto del plano en tiles. */
+#define SNOW_VIEW_WIDTH_PX 320 /* Ancho de pantalla en modo H40. */
+#define SNOW_SWAY_SHIFT 2   /* Ángulo de sinFix16 (0..1023) a índice de gameLut_sway. */
+
+/* El plano solo envuelve sin costuras si el patrón es tan alto como el plano y
+   lo visible con el vaivén (pantalla + 2 amplitudes) cabe en su ancho. */
+#define SNOW_PLANE_WRAP_FITS ((SNOW_HEIGHT_PX == SNOW_PLANE_ROWS * 8) && \
+    ((SNOW_VIEW_WIDTH_PX + 2 * SNOW_SWAY_PX) <= SNOW_PLANE_COLS * 8))
+
+static u8 snowTilesReady = FALSE; /**< TRUE cuando la región residente ya tiene los tiles. */
+
+/** @brief Marca los tiles residentes como subidos (callback de la cola de DMA). */
+static void onSnowTilesLoaded(void) {
+    snowTilesReady = TRUE;
+}
+
+/**
+ * @brief Reserva la región residente de nieve y encola sus tiles si hace falta.
+ * @return Primer tile de la región.
+ */
+static u16 queueSnowTiles(void) {
+    /* Los tiles de nieve son residentes: solo se suben la primera vez (o si
+       una fase anterior se cortó antes de que la cola terminase de enviarlos). */
+    u8 loaded;
+    const u16 snowTiles = gameCore_vramAllocResident("nieve",
+        image_primer_plano_nieve_tile.numTile, &loaded);
+    if (!loaded || !snowTilesReady) {
+        snowTilesReady = FALSE;
+        gameCore_dmaQueueTileSet(&image_primer_plano_nieve_tile, snowTiles, onSnowTilesLoaded);
+    }
+    return snowTiles;
+}
+
+/** @brief Adelanta la subida de los tiles de nieve (p. ej. durante una cutscene). */
+void snowEffect_preload(void) {
+    if (!snowTilesReady) {
+        queueSnowTiles();
+    }
+}
+
+/**
+ * @brief Vuelca el patrón de nieve en todo BG_A fila a fila.
+ *
+ * Las columnas del final del plano representan x negativas (lo que asoma por
+ * la izquierda con el vaivén), así que se rellenan con el final del patrón
+ * para que la costura caiga fuera de pantalla.
+ *
+ * @param map Mapa de nieve ya creado (solo se lee).
+ */
+static void fillSnowPlane(Map *map) {
+    const u16 patternCols = SNOW_WIDTH_PX / 8;
+    const u16 swayCols = SNOW_SWAY_PX / 8;
+    u16 source[SNOW_WIDTH_PX / 8];
+    u16 row[SNOW_PLANE_COLS];
+
+    for (u16 y = 0; y < SNOW_PLANE_ROWS; y++) {
+        MAP_getTilemapRect(map, 0, y, patternCols, 1, FALSE, source);
+        for (u16 c = 0; c < SNOW_PLANE_COLS; c++) {
+            s16 x = (c >= SNOW_PLANE_COLS - swayCols) ? (s16)c - SNOW_PLANE_COLS : (s16)c;
+            while (x < 0) x += patternCols;
+            while (x >= (s16)patternCols) x -= patternCols;
+            row[c] = source[x];
+        }
+        VDP_setTileMapDataRectEx(BG_A, row, 0, 0, y, SNOW_PLANE_COLS, 1, SNOW_PLANE_COLS, CPU);
+    }
+}
+
+/**
+ * @brief Inicializa la nieve con el modo de scroll por registros.
+ * @param effect Estructura a preparar.
+ * @param angleStep Incremento de ángulo por frame para el desplazamiento sinusoidal.
+ * @param verticalStep Desplazamiento vertical por frame.
+ */
+void snowEffect_init(SnowEffect *effect, s16 angleStep, s16 verticalStep) {
+    snowEffect_initMode(effect, angleStep, verticalStep, SNOW_MODE_PLANE_WRAP);
+}
 
 /**
  * @brief Inicializa el mapa de nieve y sus parámetros de movimiento.
  * @param effect Estructura a preparar.
- * @param tileIndex Índice global de tiles; se incrementa tras cargar el tileset.
  * @param angleStep Incremento de ángulo por frame para el desplazamiento sinusoidal.
  * @param verticalStep Desplazamiento vertical por frame.
+ * @param mode Modo pedido (cae a SNOW_MODE_MAP si el patrón no envuelve).
  */
-void snowEffect_init(SnowEffect *effect, u32 *tileIndex, s16 angleStep, s16 verticalStep) {
-    if (effect == NULL || tileIndex == NULL) return;
+void snowEffect_initMode(SnowEffect *effect, s16 angleStep, s16 verticalStep, SnowMode mode) {
+    if (effect == NULL) return;
 
     effect->offsetX = 0;           /**< Desplazamiento horizontal inicial. */
     effect->offsetY = 0;           /**< Desplazamiento vertical inicial. */
@@ -27,20 +105,82 @@ void snowEffect_init(SnowEffect *effect, u32 *tileIndex, s16 angleStep, s16 vert
     effect->map = NULL;            /**< El mapa se asignará tras cargar tiles. */
     effect->widthPx = SNOW_WIDTH_PX; /**< Ancho del patrón de nieve. */
     effect->heightPx = SNOW_HEIGHT_PX; /**< Alto del patrón de nieve. */
+    /* Las bandas solo se activan desde snowEffect_initLayers. */
+    if (mode == SNOW_MODE_LAYERED) mode = SNOW_MODE_PLANE_WRAP;
+    effect->mode = SNOW_PLANE_WRAP_FITS ? mode : SNOW_MODE_MAP; /**< Modo efectivo. */
+    effect->layers = NULL;         /**< Sin bandas salvo snowEffect_initLayers. */
+    effect->numLayers = 0;         /**< Bandas activas. */
 
     effect->angleStep = angleStep;
     effect->verticalStep = verticalStep;
 
-    VDP_loadTileSet(&image_primer_plano_nieve_tile, *tileIndex, CPU);
+    const u16 snowTiles = queueSnowTiles();
     effect->map = MAP_create(&image_primer_plano_nieve_map, BG_A,
-        TILE_ATTR_FULL(PAL_COMMON, TRUE, FALSE, FALSE, *tileIndex));
-    *tileIndex += image_primer_plano_nieve_tile.numTile;
+        TILE_ATTR_FULL(PAL_COMMON, TRUE, FALSE, FALSE, snowTiles));
 
-    if (effect->map != NULL) {
+    if (effect->map == NULL) {
+        effect->mode = SNOW_MODE_MAP;
+    } else if (effect->mode != SNOW_MODE_MAP) {
+        /* El mapa solo hace falta para leer el patrón: el plano ya no se toca. */
+        fillSnowPlane(effect->map);
+        MAP_release(effect->map);
+        effect->map = NULL;
+        VDP_setHorizontalScroll(BG_A, 0);
+        VDP_setVerticalScroll(BG_A, 0);
+    } else {
         MAP_scrollTo(effect->map, 0, 0);
     }
-    SYS_doVBlankProcess();
+    gameCore_waitVBlank();
+
+}
+
+/**
+ * @brief Inicializa la nieve por bandas sobre el plano envuelto.
+ * @param effect Estructura a preparar.
+ * @param layers Bandas de arriba abajo.
+ * @param numLayers Número de bandas.
+ * @param verticalStep Desplazamiento vertical por frame.
+ */
+void snowEffect_initLayers(SnowEffect *effect, const SnowLayer *layers, u8 numLayers, s16 verticalStep) {
+    if (effect == NULL) return;
+    snowEffect_initMode(effect, 0, verticalStep, SNOW_MODE_PLANE_WRAP);
+    if (effect->mode != SNOW_MODE_PLANE_WRAP || layers == NULL || numLayers == 0) return;
+    effect->mode = SNOW_MODE_LAYERED;
+
+    effect->layers = layers;
+    effect->numLayers = (numLayers > SNOW_MAX_LAYERS) ? SNOW_MAX_LAYERS : numLayers;
+    for (u8 i = 0; i < SNOW_MAX_LAYERS; i++) {
+        effect->layerAngle[i] = 0;
+    }
+    for (u8 i = 0; i < SNOW_SCREEN_ROWS; i++) {
+        effect->rowScroll[i] = 0;
+    }
 
+    /* El modo por tile afecta a los dos planos: BG_B queda con su tabla a 0,
+       que es lo que ya usan las fases (solo scroll vertical). */
+    VDP_setScrollingMode(HSCROLL_TILE, VSCROLL_PLANE);
+    VDP_setHorizontalScrollTile(BG_B, 0, effect->rowScroll, SNOW_SCREEN_ROWS, CPU);
+    VDP_setHorizontalScrollTile(BG_A, 0, effect->rowScroll, SNOW_SCREEN_ROWS, CPU);
+}
+
+/**
+ * @brief Rellena la tabla HSCROLL por filas con el vaivén de cada banda.
+ * @param effect Efecto en SNOW_MODE_LAYERED.
+ */
+static void updateSnowLayers(SnowEffect *effect) {
+    u8 row = 0;
+    for (u8 i = 0; i < effect->numLayers; i++) {
+        const SnowLayer *layer = &effect->layers[i];
+        effect->layerAngle[i] += layer->angleStep;
+        const u16 index = (effect->layerAngle[i] >> SNOW_SWAY_SHIFT) & (GAME_LUT_SWAY_STEPS - 1);
+        const s16 sway = (s16)((gameLut_sway[index] * (s16)layer->amplitude) >> 6);
+
+        /* La última banda llega hasta el final de la pantalla. */
+        const u8 end = (i == effect->numLayers - 1) ? SNOW_SCREEN_ROWS : row + layer->rows;
+        while (row < end && row < SNOW_SCREEN_ROWS) {
+            effect->rowScroll[row++] = -sway;
+        }
+    }
 }
 
 /**
@@ -49,9 +189,21 @@ void snowEffect_init(SnowEffect *effect, u32 *tileIndex, s16 angleStep, s16 vert
  * @param frameCounter Contador de frames que gobierna la animación.
  */
 void snowEffect_update(SnowEffect *effect, u16 frameCounter) {
-    if (effect == NULL || effect->map == NULL) return;
+    if (effect == NULL) return;
+    if (effect->mode == SNOW_MODE_MAP && effect->map == NULL) return;
 
     (void)frameCounter;
+    if (effect->mode == SNOW_MODE_LAYERED) {
+        effect->offsetY += effect->verticalStep;
+        s32 posY = effect->offsetY % SNOW_HEIGHT_PX;
+        if (posY < 0) posY += SNOW_HEIGHT_PX;
+        updateSnowLayers(effect);
+        /* Una sola tabla de 28 palabras por DMA y un registro de VSCROLL. */
+        VDP_setHorizontalScrollTile(BG_A, 0, effect->rowScroll, SNOW_SCREEN_ROWS, DMA_QUEUE);
+        VDP_setVerticalScroll(BG_A, (s16)posY);
+        return;
+    }
+
     effect->angle += effect->angleStep;
     effect->offsetX = sinFix16(effect->angle);
     effect->offsetY += effect->verticalStep;
@@ -61,5 +213,12 @@ void snowEffect_update(SnowEffect *effect, u16 frameCounter) {
     s32 posY = effect->offsetY % SNOW_HEIGHT_PX;
     if (posY < 0) posY += SNOW_HEIGHT_PX;
 
+    if (effect->mode == SNOW_MODE_PLANE_WRAP) {
+        /* Dos escrituras de registro: el vaivén nunca pasa de SNOW_SWAY_PX. */
+        VDP_setHorizontalScroll(BG_A, (s16)-effect->offsetX);
+        VDP_setVerticalScroll(BG_A, (s16)posY);
+        return;
+    }
+
     MAP_scrollTo(effect->map, (u32)posX, (u32)posY);
 }
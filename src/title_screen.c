@@ -21,9 +21,25 @@
 #define TITLE_TITULO_SCROLL_START_Y 0      /* Arranca visible el mapa titulo. */
 #define TITLE_TITULO_SCROLL_TARGET_Y 128   /* Se desplaza fuera de la pantalla. */
 
+/**
+ * @brief Estado de la pantalla de título que cruza frames de la tarea.
+ */
+typedef struct {
+    Map *mapTitulo;      /**< Mapa del título (plano B). */
+    Map *mapSleigh;      /**< Mapa "Sleigh Chase" (plano A). */
+    s16 sleighScrollY;   /**< Scroll vertical actual de mapSleigh. */
+    s16 tituloScrollY;   /**< Scroll vertical actual de mapTitulo. */
+    u8 englishSelected;  /**< Opción de idioma resaltada. */
+    u16 previousInput;   /**< Botones del frame anterior (flancos). */
+} TitleState;
+
 static void title_draw_language_options(u8 englishSelected);
+static u8 titleTask(GameTask *task);
 
 void title_show(void) {
+    static TitleState state;
+    static GameTask task;
+
     audio_stop_music();
     gameCore_resetVideoState();
 
@@ -34,68 +50,79 @@ void title_show(void) {
         PAL_setPalette(PAL_ENEMY, image_sleigh_chase_pal.data, CPU);
     }
 
-    VDP_loadTileSet(&image_titulo_tile, globalTileIndex, CPU);
-    Map* mapTitulo = MAP_create(&image_titulo_map, BG_B,
-        TILE_ATTR_FULL(PAL_PLAYER, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_titulo_tile.numTile;
-    MAP_scrollTo(mapTitulo, 0, TITLE_TITULO_SCROLL_START_Y);
+    const u16 tituloTiles = gameCore_vramAlloc("titulo", image_titulo_tile.numTile);
+    VDP_loadTileSet(&image_titulo_tile, tituloTiles, CPU);
+    state.mapTitulo = MAP_create(&image_titulo_map, BG_B,
+        TILE_ATTR_FULL(PAL_PLAYER, FALSE, FALSE, FALSE, tituloTiles));
+    MAP_scrollTo(state.mapTitulo, 0, TITLE_TITULO_SCROLL_START_Y);
 
-    VDP_loadTileSet(&image_sleigh_chase_tile, globalTileIndex, CPU);
-    Map* mapSleigh = MAP_create(&image_sleigh_chase_map, BG_A,
-        TILE_ATTR_FULL(PAL_ENEMY, FALSE, FALSE, FALSE, globalTileIndex));
-    globalTileIndex += image_sleigh_chase_tile.numTile;
+    const u16 sleighTiles = gameCore_vramAlloc("sleigh_chase", image_sleigh_chase_tile.numTile);
+    VDP_loadTileSet(&image_sleigh_chase_tile, sleighTiles, CPU);
+    state.mapSleigh = MAP_create(&image_sleigh_chase_map, BG_A,
+        TILE_ATTR_FULL(PAL_ENEMY, FALSE, FALSE, FALSE, sleighTiles));
 
-    MAP_scrollTo(mapSleigh, 0, TITLE_SCROLL_START_Y);
+    MAP_scrollTo(state.mapSleigh, 0, TITLE_SCROLL_START_Y);
 
     XGM2_playPCM(snd_sleigh_chase, sizeof(snd_sleigh_chase), SOUND_PCM_CH_AUTO);
 
-    s16 sleighScrollY = TITLE_SCROLL_START_Y;
-    s16 tituloScrollY = TITLE_TITULO_SCROLL_START_Y;
-    while (sleighScrollY > TITLE_SCROLL_TARGET_Y) {
-        // kprintf("Haciendo map hacia (0, %d)", sleighScrollY);
-        MAP_scrollTo(mapSleigh, 0, sleighScrollY);
-        MAP_scrollTo(mapTitulo, 0, tituloScrollY);
-        sleighScrollY -= 1;
-        tituloScrollY += 1;
-        SYS_doVBlankProcess();
+    state.sleighScrollY = TITLE_SCROLL_START_Y;
+    state.tituloScrollY = TITLE_TITULO_SCROLL_START_Y;
+    gameCore_taskRun(&task, titleTask, &state);
+
+    MAP_release(state.mapSleigh);
+    MAP_release(state.mapTitulo);
+    gameCore_fadeToBlack();
+    gameCore_resetVideoState(); /* Limpia recursos de la intro (Sleigh Chase) antes de la fase 1. */
+}
+
+/* --- Helpers --- */
+
+/**
+ * @brief Scroll de entrada y menú de idioma como tarea reanudable.
+ */
+static u8 titleTask(GameTask *task) {
+    TitleState *state = (TitleState*)task->data;
+
+    GAME_TASK_BEGIN(task);
+    while (state->sleighScrollY > TITLE_SCROLL_TARGET_Y) {
+        // kprintf("Haciendo map hacia (0, %d)", state->sleighScrollY);
+        MAP_scrollTo(state->mapSleigh, 0, state->sleighScrollY);
+        MAP_scrollTo(state->mapTitulo, 0, state->tituloScrollY);
+        state->sleighScrollY -= 1;
+        state->tituloScrollY += 1;
+        GAME_TASK_YIELD(task);
     }
-    MAP_scrollTo(mapSleigh, 0, TITLE_SCROLL_TARGET_Y);
-    MAP_scrollTo(mapTitulo, 0, TITLE_TITULO_SCROLL_TARGET_Y);
+    MAP_scrollTo(state->mapSleigh, 0, TITLE_SCROLL_TARGET_Y);
+    MAP_scrollTo(state->mapTitulo, 0, TITLE_TITULO_SCROLL_TARGET_Y);
 
     VDP_loadFont(font_dark.tileset, DMA);
     PAL_setPalette(PAL_EFFECT, font_dark.palette->data, CPU);
     VDP_setTextPalette(PAL_EFFECT);
 
-    u8 englishSelected = TRUE;
-    title_draw_language_options(englishSelected);
+    state->englishSelected = TRUE;
+    title_draw_language_options(state->englishSelected);
 
-    u16 previousInput = 0;
+    state->previousInput = 0;
     while (TRUE) {
-        const u16 input = JOY_readJoypad(JOY_1);
-        const u16 pressed = input & ~previousInput;
+        const u16 input = gameCore_readInput();
+        const u16 pressed = input & ~state->previousInput;
 
         if (pressed & (BUTTON_UP | BUTTON_DOWN)) {
-            englishSelected = !englishSelected;
-            title_draw_language_options(englishSelected);
+            state->englishSelected = !state->englishSelected;
+            title_draw_language_options(state->englishSelected);
         }
 
         if (input & (BUTTON_START | BUTTON_A | BUTTON_B | BUTTON_C)) {
-            g_selectedLanguage = englishSelected ? GAME_LANG_ENGLISH : GAME_LANG_SPANISH;
+            g_selectedLanguage = state->englishSelected ? GAME_LANG_ENGLISH : GAME_LANG_SPANISH;
             break;
         }
 
-        previousInput = input;
-        SYS_doVBlankProcess();
+        state->previousInput = input;
+        GAME_TASK_YIELD(task);
     }
-
-    MAP_release(mapSleigh);
-    MAP_release(mapTitulo);
-    gameCore_fadeToBlack();
-    gameCore_resetVideoState(); /* Limpia recursos de la intro (Sleigh Chase) antes de la fase 1. */
+    GAME_TASK_END(task);
 }
 
-/* --- Helpers --- */
-
 static void title_draw_language_options(u8 englishSelected) {
     const char* englishText = englishSelected ? "} ENGLISH {" : "ENGLISH";
     const char* spanishText = englishSelected ? "ESPA^OL" : "} ESPA^OL {";
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Genera las tablas precalculadas de matemática fix16 del juego.
+
+Escribe inc/game_luts.h (constantes, declaraciones y macros de acceso) y
+src/game_luts.c (datos const en ROM). Las dos salidas se versionan para que la
+build de SGDK no necesite Python; la build de host las regenera si cambia este
+script (make -C host luts).
+
+Tablas:
+  gameLut_recip  ceil(2^RECIP_SHIFT / n): divide por n (1..RECIP_SIZE-1) con
+                 una multiplicación y un desplazamiento (sin DIVS).
+  gameLut_arc    4t(1-t) en fix16 para cada progreso t = i/64 (i = 0..64):
+                 factor de altura de una parábola de lanzamiento.
+  gameLut_sway   64*sin(2*pi*i/SWAY_STEPS): vaivén en píxeles de la nieve.
+
+Uso: python3 tools/gen_luts.py
+"""
+
+import math
+import os
+
+FIX16_FRAC_BITS = 6            # fix16 de SGDK: 10.6
+FIX16_ONE = 1 << FIX16_FRAC_BITS
+RECIP_SIZE = 256               # divisores admitidos: 1..255
+RECIP_SHIFT = 15               # ceil(32768 / n) cabe en u16 incluso para n = 1
+ARC_STEPS = FIX16_ONE + 1      # un valor por cada progreso fix16 de 0 a 1
+SWAY_STEPS = 256               # vuelta completa del vaivén
+SWAY_AMPLITUDE = 64            # igual que SNOW_SWAY_PX
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER_PATH = os.path.join(ROOT, "inc", "game_luts.h")
+SOURCE_PATH = os.path.join(ROOT, "src", "game_luts.c")
+
+BANNER = "/* Generado por tools/gen_luts.py: no editar a mano. */\n"
+
+
+def recip_table():
+    table = [0]
+    for n in range(1, RECIP_SIZE):
+        table.append(-(-(1 << RECIP_SHIFT) // n))  # división entera por exceso
+    return table
+
+
+def arc_table():
+    table = []
+    for i in range(ARC_STEPS):
+        t = i / FIX16_ONE
+        table.append(int(round(4.0 * t * (1.0 - t) * FIX16_ONE)))
+    return table
+
+
+def sway_table():
+    return [int(round(SWAY_AMPLITUDE * math.sin(2.0 * math.pi * i / SWAY_STEPS)))
+            for i in range(SWAY_STEPS)]
+
+
+def format_rows(values, per_row=16):
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append("    " + ", ".join(str(v) for v in values[i:i + per_row]) + ",")
+    return "\n".join(rows)
+
+
+def write_header():
+    text = BANNER + f"""#ifndef _GAME_LUTS_H_
+#define _GAME_LUTS_H_
+
+#include <genesis.h>
+
+/**
+ * @file game_luts.h
+ * @brief Tablas precalculadas para la matemática fix16 de los bucles calientes.
+ *
+ * Sustituyen divisiones (DIVS) y cadenas de F16_mul por una consulta y, como
+ * mucho, una multiplicación. Para cambiarlas edita tools/gen_luts.py.
+ */
+
+#define GAME_LUT_RECIP_SIZE {RECIP_SIZE}   /* Divisores admitidos por GAME_LUT_RATIO_FIX16: 1..{RECIP_SIZE - 1}. */
+#define GAME_LUT_RECIP_SHIFT {RECIP_SHIFT}  /* Escala de gameLut_recip (2^{RECIP_SHIFT}). */
+#define GAME_LUT_ARC_STEPS {ARC_STEPS}     /* Entradas de gameLut_arc (progreso fix16 de 0 a FIX16(1)). */
+#define GAME_LUT_SWAY_STEPS {SWAY_STEPS}   /* Entradas de gameLut_sway (una vuelta). */
+
+/** @brief ceil(2^GAME_LUT_RECIP_SHIFT / n); la entrada 0 no se usa. */
+extern const u16 gameLut_recip[GAME_LUT_RECIP_SIZE];
+
+/** @brief 4t(1-t) en fix16 indexado por el progreso t en fix16 (0..FIX16(1)). */
+extern const u8 gameLut_arc[GAME_LUT_ARC_STEPS];
+
+/** @brief {SWAY_AMPLITUDE}*sin(2*pi*i/GAME_LUT_SWAY_STEPS) en píxeles. */
+extern const s8 gameLut_sway[GAME_LUT_SWAY_STEPS];
+
+/**
+ * @brief d/n en fix16 sin dividir (n entre 1 y GAME_LUT_RECIP_SIZE - 1).
+ *
+ * Exacto cuando d es múltiplo de n y nunca por debajo del cociente real.
+ */
+#define GAME_LUT_RATIO_FIX16(d, n) \\
+    ((fix16)(((s32)(d) * (s32)gameLut_recip[(n)]) >> (GAME_LUT_RECIP_SHIFT - FIX16_FRAC_BITS)))
+
+#endif
+"""
+    with open(HEADER_PATH, "w", encoding="utf-8", newline="\n") as out:
+        out.write(text)
+
+
+def write_source():
+    text = BANNER + f"""/**
+ * @file game_luts.c
+ * @brief Datos de las tablas precalculadas (ver game_luts.h).
+ */
+
+#include "game_luts.h"
+
+const u16 gameLut_recip[GAME_LUT_RECIP_SIZE] = {{
+{format_rows(recip_table())}
+}};
+
+const u8 gameLut_arc[GAME_LUT_ARC_STEPS] = {{
+{format_rows(arc_table())}
+}};
+
+const s8 gameLut_sway[GAME_LUT_SWAY_STEPS] = {{
+{format_rows(sway_table())}
+}};
+"""
+    with open(SOURCE_PATH, "w", encoding="utf-8", newline="\n") as out:
+        out.write(text)
+
+
+if __name__ == "__main__":
+    write_header()
+    write_source()